@@ -0,0 +1,134 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_DBO_BULK_INSERT_IMPL_H_
+#define WT_DBO_BULK_INSERT_IMPL_H_
+
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <Wt/Dbo/Exception>
+#include <Wt/Dbo/SqlConnection>
+#include <Wt/Dbo/SqlStatement>
+#include <Wt/Dbo/DbAction>
+
+namespace Wt {
+  namespace Dbo {
+
+template <class C>
+BulkInsert<C>::BulkInsert(Session& session)
+  : session_(session),
+    transaction_(session),
+    statement_(0),
+    bulkStatement_(false),
+    finished_(false),
+    count_(0),
+    batchCount_(0)
+{
+  session_.flush();
+
+  Session::Mapping<C> *mapping = session_.getMapping<C>();
+
+  /*
+   * The columns are those of the insert statement: the version and
+   * the fields, but not the surrogate id which is generated.
+   */
+  std::vector<std::string> columns;
+  if (mapping->versionFieldName)
+    columns.push_back(std::string("\"") + mapping->versionFieldName + "\"");
+
+  for (unsigned i = 0; i < mapping->fields.size(); ++i)
+    columns.push_back("\"" + mapping->fields[i].name() + "\"");
+
+  std::string table = "\"" + Impl::quoteSchemaDot(mapping->tableName) + "\"";
+
+  statement_ = session_.connection(true)
+    ->prepareBulkInsertStatement(table, columns);
+
+  if (statement_)
+    bulkStatement_ = true;
+  else
+    statement_ = session_.getStatement<C>(Session::SqlInsert);
+}
+
+template <class C>
+BulkInsert<C>::~BulkInsert()
+{
+  if (statement_)
+    release();
+
+  if (!finished_) {
+    try {
+      transaction_.rollback();
+    } catch (std::exception& e) {
+      std::cerr << "BulkInsert::~BulkInsert(): " << e.what() << std::endl;
+    }
+  }
+}
+
+template <class C>
+void BulkInsert<C>::insert(const C& obj)
+{
+  if (!statement_)
+    throw Exception("BulkInsert::insert(): bulk insert was finished");
+
+  statement_->reset();
+
+  int column = 0;
+  if (session_.getMapping<C>()->versionFieldName)
+    statement_->bind(column++, 0);
+
+  SaveBaseAction action(&session_, statement_, column);
+  persist<C>::apply(const_cast<C&>(obj), action);
+
+  statement_->addBatch();
+  ++count_;
+
+  /*
+   * A bulk insert statement (e.g. a Postgres COPY) sends its rows as
+   * they are added, and is only completed by finish().
+   */
+  if (!bulkStatement_ && ++batchCount_ == BatchSize) {
+    statement_->executeBatch();
+    batchCount_ = 0;
+  }
+}
+
+template <class C>
+void BulkInsert<C>::finish()
+{
+  if (statement_) {
+    try {
+      statement_->executeBatch();
+    } catch (...) {
+      release();
+      throw;
+    }
+
+    release();
+
+    finished_ = true;
+    transaction_.commit();
+  }
+}
+
+template <class C>
+void BulkInsert<C>::release()
+{
+  if (bulkStatement_)
+    delete statement_;
+  else
+    statement_->done();
+
+  statement_ = 0;
+}
+
+  }
+}
+
+#endif // WT_DBO_BULK_INSERT_IMPL_H_
@@ -317,6 +317,19 @@ void LoadDbAction<C>::actId(ptr<D>& value, const std::string& name, int size,
      * SaveDbAction
      */
 
+template<typename V>
+void SaveBaseAction::actId(V& value, const std::string& name, int size)
+{
+  field(*this, value, name, size);
+}
+
+template<class C>
+void SaveBaseAction::actId(ptr<C>& value, const std::string& name, int size,
+			   int fkConstraints)
+{
+  actPtr(PtrRef<C>(value, name, size, fkConstraints));
+}
+
 template<class C>
 void SaveBaseAction::actPtr(const PtrRef<C>& field)
 {
@@ -442,43 +455,35 @@ SaveDbAction<C>::SaveDbAction(MetaDbo<C>& dbo, Session::Mapping<C>& mapping)
     dbo_(dbo)
 { }
 
+template<class C>
+bool SaveDbAction<C>::isInsert() const
+{
+  return dbo_.deletedInTransaction()
+    || (dbo_.isNew() && !dbo_.savedInTransaction());
+}
+
 template<class C>
 void SaveDbAction<C>::visit(C& obj)
 {
   /*
    * (1) Dependencies
    */
-  startDependencyPass();
-
-  persist<C>::apply(obj, *this);
+  visitDependencies(obj);
 
   /*
    * (2) Self
    */
   {
     ScopedStatementUse use(statement_);
-    if (!statement_) {
-      isInsert_ = dbo_.deletedInTransaction()
-	|| (dbo_.isNew() && !dbo_.savedInTransaction());
-
-      use(statement_ = isInsert_
+    if (!statement_)
+      use(statement_ = isInsert()
 	  ? dbo_.session()->template getStatement<C>(Session::SqlInsert)
 	  : dbo_.session()->template getStatement<C>(Session::SqlUpdate));
-    } else
-      isInsert_ = false;
-
-    startSelfPass();
-    persist<C>::apply(obj, *this);
 
-    if (!isInsert_) {
-      dbo_.bindId(statement_, column_);
+    statement_->reset();
 
-      if (mapping().versionFieldName) {
-	// when saved in the transaction, we will be at version() + 1
-	statement_->bind(column_++, dbo_.version()
-			 + (dbo_.savedInTransaction() ? 1 : 0));
-      }
-    }
+    int column = 0;
+    bindSelf(obj, statement_, column);
 
     exec();
 
@@ -499,10 +504,46 @@ void SaveDbAction<C>::visit(C& obj)
    *  - inserts in ManyToMany collections
    *  - deletes from ManyToMany collections
    */
-  if (needSetsPass_) {
-    startSetsPass();
-    persist<C>::apply(obj, *this);
+  if (needSetsPass_)
+    visitSets(obj);
+}
+
+template<class C>
+void SaveDbAction<C>::visitDependencies(C& obj)
+{
+  startDependencyPass();
+
+  persist<C>::apply(obj, *this);
+}
+
+template<class C>
+void SaveDbAction<C>::bindSelf(C& obj, SqlStatement *statement, int& column)
+{
+  statement_ = statement;
+  column_ = column;
+  isInsert_ = isInsert();
+
+  startSelfPass();
+  persist<C>::apply(obj, *this);
+
+  if (!isInsert_) {
+    dbo_.bindId(statement_, column_);
+
+    if (mapping().versionFieldName) {
+      // when saved in the transaction, we will be at version() + 1
+      statement_->bind(column_++, dbo_.version()
+		       + (dbo_.savedInTransaction() ? 1 : 0));
+    }
   }
+
+  column = column_;
+}
+
+template<class C>
+void SaveDbAction<C>::visitSets(C& obj)
+{
+  startSetsPass();
+  persist<C>::apply(obj, *this);
 }
 
 template<class C>
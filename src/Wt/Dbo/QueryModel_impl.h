@@ -226,19 +226,28 @@ Result& QueryModel<Result>::resultRow(int row)
       || row >= cacheStart_ + static_cast<int>(cache_.size())) {
     cacheStart_ = std::max(row - batchSize_ / 4, 0);
 
+    /*
+     * The batch is read at once into the cache, and thus its results
+     * can be streamed: this is done with a copy so that the model's
+     * query (see query()) is left as it was set.
+     */
+    Query<Result> batch = query_;
+
     int qOffset = cacheStart_;
     if (queryOffset_ > 0)
       qOffset += queryOffset_;
-    query_.offset(qOffset);
+    batch.offset(qOffset);
 
     int qLimit = batchSize_;
     if (queryLimit_ > 0)
       qLimit = std::min(batchSize_, queryLimit_ - cacheStart_);
-    query_.limit(qLimit);
+    batch.limit(qLimit);
+
+    batch.streaming(true);
 
     Transaction transaction(query_.session());
 
-    collection<Result> results = query_.resultList();
+    collection<Result> results = batch.resultList();
     cache_.clear();
     cache_.insert(cache_.end(), results.begin(), results.end());   
 
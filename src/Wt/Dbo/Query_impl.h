@@ -7,12 +7,14 @@
 #ifndef WT_DBO_QUERY_IMPL_H_
 #define WT_DBO_QUERY_IMPL_H_
 
+#include <boost/bind.hpp>
 #include <boost/tuple/tuple.hpp>
 
 #include <Wt/Dbo/Exception>
 #include <Wt/Dbo/Field>
 #include <Wt/Dbo/SqlStatement>
 #include <Wt/Dbo/DbAction>
+#include <Wt/Dbo/Transaction>
 
 #include <Wt/Dbo/Field_impl.h>
 
@@ -329,14 +331,16 @@ namespace Impl {
 template <class Result>
 Query<Result, DynamicBinding>::Query()
   : limit_(-1),
-    offset_(-1)
+    offset_(-1),
+    streaming_(false)
 { }
 
 template <class Result>
 Query<Result, DynamicBinding>::Query(Session& session, const std::string& sql)
   : Impl::QueryBase<Result>(session, sql),
     limit_(-1),
-    offset_(-1)
+    offset_(-1),
+    streaming_(false)
 { }
 
 template <class Result>
@@ -345,7 +349,8 @@ Query<Result, DynamicBinding>::Query(Session& session,
 				     const std::string& where)
   : Impl::QueryBase<Result>(session, table, where),
     limit_(-1),
-    offset_(-1)
+    offset_(-1),
+    streaming_(false)
 { }
 
 template <class Result>
@@ -356,7 +361,8 @@ Query<Result, DynamicBinding>
     groupBy_(other.groupBy_),
     orderBy_(other.orderBy_),
     limit_(other.limit_),
-    offset_(other.offset_)
+    offset_(other.offset_),
+    streaming_(other.streaming_)
 { 
   for (unsigned i = 0; i < other.parameters_.size(); ++i)
     parameters_.push_back(other.parameters_[i]->clone());
@@ -373,6 +379,7 @@ Query<Result, DynamicBinding>::operator=
   orderBy_ = other.orderBy_;
   limit_ = other.limit_;
   offset_ = other.offset_;
+  streaming_ = other.streaming_;
 
   reset();
 
@@ -460,6 +467,21 @@ int Query<Result, DynamicBinding>::limit() const
   return limit_;
 }
 
+template <class Result>
+Query<Result, DynamicBinding>&
+Query<Result, DynamicBinding>::streaming(bool enabled)
+{
+  streaming_ = enabled;
+
+  return *this;
+}
+
+template <class Result>
+bool Query<Result, DynamicBinding>::streaming() const
+{
+  return streaming_;
+}
+
 template <class Result>
 Result Query<Result, DynamicBinding>::resultValue() const
 {
@@ -482,7 +504,69 @@ collection<Result> Query<Result, DynamicBinding>::resultList() const
   bindParameters(statement);
   bindParameters(countStatement);
 
-  return collection<Result>(this->session_, statement, countStatement);
+  return collection<Result>(this->session_, statement, countStatement,
+			    streaming_);
+}
+
+template <class Result>
+void Query<Result, DynamicBinding>::resultListAsync(const Callback& callback)
+  const
+{
+  if (!this->session_) {
+    callback(collection<Result>());
+    return;
+  }
+
+  if (streaming_)
+    throw Exception("Query::resultListAsync(): cannot be combined with "
+		    "a streaming query");
+
+  /*
+   * The session takes a transaction of its own for the execution.
+   */
+  Transaction transaction(*this->session_);
+
+  this->session_->flush();
+
+  SqlStatement *statement, *countStatement;
+
+  boost::tie(statement, countStatement)
+    = this->statements(where_, groupBy_, orderBy_, limit_, offset_);
+
+  bindParameters(statement);
+  bindParameters(countStatement);
+
+  try {
+    this->session_->executeAsync
+      (statement, boost::bind(&Query<Result, DynamicBinding>::resultListDone,
+			      this->session_, statement, countStatement,
+			      callback, _1));
+  } catch (...) {
+    statement->done();
+    if (countStatement)
+      countStatement->done();
+    throw;
+  }
+}
+
+template <class Result>
+void Query<Result, DynamicBinding>
+::resultListDone(Session *session, SqlStatement *statement,
+		 SqlStatement *countStatement,
+		 const Callback& callback, const boost::exception_ptr& error)
+{
+  if (error) {
+    statement->done();
+    if (countStatement)
+      countStatement->done();
+
+    boost::rethrow_exception(error);
+  }
+
+  collection<Result> results(session, statement, countStatement);
+  results.data_.query.executed = true;
+
+  callback(results);
 }
 
 template <class Result>
@@ -259,17 +259,111 @@ void Session::implSave(MetaDbo<C>& dbo)
   Session::Mapping<C> *mapping = getMapping<C>();
 
   SaveDbAction<C> action(dbo, *mapping);
+
+  /*
+   * While flushing, the object is saved later together with other
+   * objects of the same class (see implSaveBatch()).
+   */
+  bool insert = action.isInsert();
+  if (flushing_ && (!insert || mapping->batchInserts)) {
+    action.visitDependencies(*dbo.obj());
+
+    dbo.setSavePending();
+    addToBatch(&dbo, mapping, insert);
+    return;
+  }
+
+  flushBatch();
+
   action.visit(*dbo.obj());
 
   mapping->registry_[dbo.id()] = &dbo;
 }
 
+template<class C>
+void Session::implSaveBatch(const std::vector<MetaDboBase *>& dbos,
+			    bool insert)
+{
+  Session::Mapping<C> *mapping = getMapping<C>();
+
+  std::vector<bool> needSetsPass(dbos.size());
+
+  if (insert) {
+    for (unsigned i = 0; i < dbos.size();) {
+      int rows = insertBatchRows(mapping, dbos.size() - i);
+
+      SqlStatement *statement = getInsertStatement(mapping, rows);
+      ScopedStatementUse use(statement);
+
+      statement->reset();
+
+      int column = 0;
+      for (int j = 0; j < rows; ++j) {
+	MetaDbo<C>& dbo = static_cast< MetaDbo<C>& >(*dbos[i + j]);
+
+	SaveDbAction<C> action(dbo, *mapping);
+	action.bindSelf(*dbo.obj(), statement, column);
+	needSetsPass[i + j] = action.needSetsPass();
+      }
+
+      statement->execute();
+
+      for (int j = 0; j < rows; ++j)
+	dbos[i + j]->setTransactionState(MetaDboBase::SavedInTransaction);
+
+      i += rows;
+    }
+  } else {
+    SqlStatement *statement = getStatement<C>(SqlUpdate);
+    ScopedStatementUse use(statement);
+
+    for (unsigned i = 0; i < dbos.size(); ++i) {
+      MetaDbo<C>& dbo = static_cast< MetaDbo<C>& >(*dbos[i]);
+
+      statement->reset();
+
+      int column = 0;
+      SaveDbAction<C> action(dbo, *mapping);
+      action.bindSelf(*dbo.obj(), statement, column);
+      needSetsPass[i] = action.needSetsPass();
+
+      statement->addBatch();
+    }
+
+    std::vector<int> modifiedCounts = statement->executeBatch();
+
+    for (unsigned i = 0; i < dbos.size(); ++i)
+      dbos[i]->setTransactionState(MetaDboBase::SavedInTransaction);
+
+    for (unsigned i = 0; i < dbos.size(); ++i)
+      if (modifiedCounts[i] != 1) {
+	MetaDbo<C>& dbo = static_cast< MetaDbo<C>& >(*dbos[i]);
+	std::string idString = boost::lexical_cast<std::string>(dbo.id());
+
+	throw StaleObjectException(idString, dbo.version());
+      }
+  }
+
+  for (unsigned i = 0; i < dbos.size(); ++i) {
+    MetaDbo<C>& dbo = static_cast< MetaDbo<C>& >(*dbos[i]);
+
+    mapping->registry_[dbo.id()] = &dbo;
+
+    if (needSetsPass[i]) {
+      SaveDbAction<C> action(dbo, *mapping);
+      action.visitSets(*dbo.obj());
+    }
+  }
+}
+
 template<class C>
 void Session::implDelete(MetaDbo<C>& dbo)
 {
   if (!transaction_)
     throw Exception("Dbo save(): no active transaction");
 
+  flushBatch();
+
   // when saved in transaction, we are already in this list
   if (!dbo.savedInTransaction())
     transaction_->objects_.push_back(new ptr<C>(&dbo));
@@ -357,6 +451,14 @@ void Session::Mapping<C>::rereadAll()
   }
 }
 
+template <class C>
+void Session::Mapping<C>::saveBatch(Session& session,
+				    const std::vector<MetaDboBase *>& dbos,
+				    bool insert)
+{
+  session.implSaveBatch<C>(dbos, insert);
+}
+
 template <class C>
 void Session::Mapping<C>::init(Session& session)
 {
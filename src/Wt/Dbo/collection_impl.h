@@ -254,13 +254,15 @@ collection<C>::collection()
 
 template <class C>
 collection<C>::collection(Session *session, SqlStatement *statement,
-			  SqlStatement *countStatement)
+			  SqlStatement *countStatement, bool streaming)
   : session_(session),
     type_(QueryCollection)
 {
   data_.query.statement = statement;
   data_.query.countStatement = countStatement;
   data_.query.size = -1;
+  data_.query.streaming = streaming;
+  data_.query.executed = false;
 }
 
 template <class C>
@@ -298,6 +300,14 @@ SqlStatement *collection<C>::executeStatement() const
 {
   SqlStatement *statement = 0;
 
+  /*
+   * The statement of an asynchronous query was already executed.
+   */
+  if (type_ == QueryCollection && data_.query.executed) {
+    data_.query.executed = false;
+    return data_.query.statement;
+  }
+
   if (session_)
     session_->flush();
 
@@ -311,8 +321,12 @@ SqlStatement *collection<C>::executeStatement() const
     }
   }
 
-  if (statement)
-    statement->execute();
+  if (statement) {
+    if (type_ == QueryCollection && data_.query.streaming)
+      statement->executeStreaming();
+    else
+      statement->execute();
+  }
 
   return statement;
 }
@@ -78,7 +78,13 @@ void MetaDbo<C>::flush()
 
     try {
       session()->implSave(*this);
-      setTransactionState(SavedInTransaction);
+
+      /*
+       * When the save is pending in a batch, the state is updated
+       * when the batch is executed.
+       */
+      if (!isSavePending())
+	setTransactionState(SavedInTransaction);
     } catch (...) {
       setTransactionState(SavedInTransaction);
       throw;
@@ -381,8 +387,12 @@ ptr<C>::operator bool() const
 template <class C>
 void ptr<C>::flush() const
 {
-  if (obj_)
+  if (obj_) {
     obj_->flush();
+
+    if (obj_->isSavePending())
+      obj_->session()->flushBatch();
+  }
 }
 
 template <class C>
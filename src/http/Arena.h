@@ -0,0 +1,138 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * All rights reserved.
+ */
+#ifndef HTTP_ARENA_HPP
+#define HTTP_ARENA_HPP
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#ifdef WT_THREADED
+#include <boost/thread/mutex.hpp>
+#endif // WT_THREADED
+
+namespace http {
+namespace server {
+
+/// A memory arena for the objects that handle a request.
+/*
+ * Each connection owns an arena, from which the reply objects (and
+ * their headers) for its requests are allocated by bumping a pointer.
+ * The arena is rewound as soon as nothing allocated from it is in use
+ * anymore, which for a keep-alive connection is after every reply.
+ *
+ * When the arena is full, memory is allocated from the heap instead,
+ * and the arena grows when it is next rewound, so that it settles at
+ * the size needed for the requests of its connection.
+ */
+class Arena : private boost::noncopyable
+{
+public:
+  /// Construct an arena with an initial size.
+  explicit Arena(std::size_t size = 4 * 1024);
+
+  ~Arena();
+
+  void *allocate(std::size_t size);
+  void deallocate(void *p);
+
+  /// The size of the arena (not counting heap allocations).
+  std::size_t size() const { return end_ - begin_; }
+
+private:
+  char *begin_, *end_, *top_;
+  std::size_t live_;     // allocations not yet deallocated
+  std::size_t overflow_; // bytes allocated from the heap since rewinding
+
+#ifdef WT_THREADED
+  boost::mutex mutex_;
+#endif // WT_THREADED
+
+  void rewind();
+};
+
+typedef boost::shared_ptr<Arena> ArenaPtr;
+
+/// An STL allocator that allocates from an arena.
+/*
+ * Without an arena, this allocates using operator new.
+ */
+template <typename T>
+class ArenaAllocator
+{
+public:
+  typedef T value_type;
+  typedef T *pointer;
+  typedef const T *const_pointer;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  template <typename U>
+  struct rebind {
+    typedef ArenaAllocator<U> other;
+  };
+
+  ArenaAllocator() { }
+
+  explicit ArenaAllocator(const ArenaPtr& arena)
+    : arena_(arena)
+  { }
+
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other)
+    : arena_(other.arena())
+  { }
+
+  const ArenaPtr& arena() const { return arena_; }
+
+  pointer address(reference r) const { return &r; }
+  const_pointer address(const_reference r) const { return &r; }
+
+  pointer allocate(size_type n, const void * = 0) {
+    std::size_t size = n * sizeof(T);
+    if (arena_)
+      return static_cast<pointer>(arena_->allocate(size));
+    else
+      return static_cast<pointer>(::operator new(size));
+  }
+
+  void deallocate(pointer p, size_type) {
+    if (arena_)
+      arena_->deallocate(p);
+    else
+      ::operator delete(p);
+  }
+
+  size_type max_size() const {
+    return (std::numeric_limits<size_type>::max)() / sizeof(T);
+  }
+
+  void construct(pointer p, const T& value) { new (p) T(value); }
+  void destroy(pointer p) { p->~T(); }
+
+  template <typename U>
+  bool operator==(const ArenaAllocator<U>& other) const {
+    return arena_ == other.arena();
+  }
+
+  template <typename U>
+  bool operator!=(const ArenaAllocator<U>& other) const {
+    return arena_ != other.arena();
+  }
+
+private:
+  ArenaPtr arena_;
+};
+
+} // namespace server
+} // namespace http
+
+#endif // HTTP_ARENA_HPP
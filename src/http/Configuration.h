@@ -41,6 +41,7 @@ public:
   void setOptions(int argc, char **argv, const std::string& configurationFile);
 
   int threads() const { return threads_; }
+  int reactors() const { return reactors_; }
   const std::string& docRoot() const { return docRoot_; }
   const std::string& appRoot() const { return appRoot_; }
   bool defaultStatic() const { return defaultStatic_; }
@@ -51,6 +52,9 @@ public:
   const std::string& pidPath() const { return pidPath_; }
   const std::string& serverName() const { return serverName_; }
   bool compression() const { return compression_; }
+  int compressionLevel() const { return compressionLevel_; }
+  int compressionMinSize() const { return compressionMinSize_; }
+  bool sendFile() const { return sendFile_; }
   bool gdb() const { return gdb_; }
   const std::string& configPath() const { return configPath_; }
 
@@ -74,12 +78,15 @@ public:
   const std::string& accessLog() const { return accessLog_; }
 
   ::int64_t maxMemoryRequestSize() const { return maxMemoryRequestSize_; }
+  ::int64_t staticCacheSize() const { return staticCacheSize_; }
+  int maxPipelinedRequests() const { return maxPipelinedRequests_; }
 
 private:
   Wt::WLogger& logger_;
   bool silent_;
 
   int threads_;
+  int reactors_;
   std::string docRoot_, appRoot_;
   bool defaultStatic_;
   std::vector<std::string> staticPaths_;
@@ -88,6 +95,9 @@ private:
   std::string pidPath_;
   std::string serverName_;
   bool compression_;
+  int compressionLevel_;
+  int compressionMinSize_;
+  bool sendFile_;
   bool gdb_;
   std::string configPath_;
 
@@ -109,6 +119,8 @@ private:
   std::string accessLog_;
 
   ::int64_t maxMemoryRequestSize_;
+  ::int64_t staticCacheSize_;
+  int maxPipelinedRequests_;
 
   void createOptions(po::options_description& options);
   void readOptions(const po::variables_map& vm);
@@ -23,9 +23,13 @@ typedef boost::system::error_code asio_error_code;
 typedef boost::system::system_error asio_system_error;
 
 #include <boost/array.hpp>
+#include <boost/circular_buffer.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/enable_shared_from_this.hpp>
+#ifdef WT_THREADED
+#include <boost/thread/mutex.hpp>
+#endif // WT_THREADED
 
 #include "Buffer.h"
 #include "Reply.h"
@@ -67,14 +71,22 @@ public:
 
   Server *server() const { return server_; }
 
+  /// The io_service of the reactor that serves this connection.
+  asio::io_service& service() { return service_; }
+
+  /// Whether a file can be transmitted directly to the socket (sendfile())
+  virtual bool canSendFile() const;
+
 #ifdef HTTP_WITH_SSL
-  void registerSslHandle(SSL *ssl) { request_.ssl = ssl; }
+  void registerSslHandle(SSL *ssl) { request_->ssl = ssl; }
 #endif
 
 public: // huh?
   void handleWriteResponse(const asio_error_code& e);
   void handleWriteResponse();
   void startWriteResponse();
+  /// Start writing a reply, or mark it ready if it is still pipelined.
+  void startWriteResponse(ReplyPtr reply);
   void handleReadRequest(const asio_error_code& e,
 			 std::size_t bytes_transferred);
   /// Process read buffer, reading request.
@@ -107,15 +119,35 @@ private:
   void handleError(const asio_error_code& e);
   void sendStockReply(Reply::status_type code);
 
+  /*
+   * Pipelining: requests are read and dispatched while the replies of
+   * earlier requests are still pending, and these are transmitted
+   * in order
+   */
+  void addReply(ReplyPtr reply);
+  void nextReply();
+  void nextRequest();
+  bool suspendRead(std::size_t maxPending);
+  void resumeRead();
+
   /*
    * Asynchronoulsy writing a response
    */
   virtual void startAsyncWriteResponse
       (const std::vector<asio::const_buffer>& buffers, int timeout) = 0;
 
+  /*
+   * Asynchronously writing a range of a file, if canSendFile()
+   */
+  virtual void startAsyncSendFile(int fd, ::int64_t offset, ::int64_t length,
+				  int timeout);
+
   /// The handler used to process the incoming request.
   RequestHandler& request_handler_;
 
+  /// The io_service used for this connection's operations.
+  asio::io_service& service_;
+
   void cancelReadTimer();
   void cancelWriteTimer();
 
@@ -130,14 +162,43 @@ private:
   Buffer::iterator remaining_;
 
   /// The incoming request.
-  Request request_;
+  RequestPtr request_;
 
   /// The parser for the incoming request.
   RequestParser request_parser_;
 
-  /// The reply to be sent back to the client.
+  /// The reply that consumes the request body (or WebSocket messages).
+  ReplyPtr bodyReply_;
+
+  /// The reply to be sent back to the client (the first pending reply).
   ReplyPtr reply_;
 
+  struct PendingReply {
+    RequestPtr request;
+    ReplyPtr reply;
+    bool ready; // send() was called while an earlier reply was pending
+
+    PendingReply(RequestPtr aRequest, ReplyPtr aReply)
+      : request(aRequest), reply(aReply), ready(false) { }
+  };
+
+  /// The replies that have not yet been sent, in order, starting with reply_
+  boost::circular_buffer<PendingReply> pending_;
+
+  /// Requests of sent replies, for reuse
+  std::vector<RequestPtr> spareRequests_;
+
+  /// Reading was suspended until a pending reply has been sent
+  bool readSuspended_;
+
+#ifdef WT_THREADED
+  /// Protects reply_, pending_, spareRequests_ and readSuspended_
+  boost::mutex pendingMutex_;
+#endif // WT_THREADED
+
+  /// The buffers being written, kept to reuse their memory
+  std::vector<asio::const_buffer> writeBuffers_;
+
   /// The reply is complete.
   bool moreDataToSendNow_;
 
@@ -0,0 +1,81 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * All rights reserved.
+ */
+#ifndef HTTP_DEFLATE_POOL_HPP
+#define HTTP_DEFLATE_POOL_HPP
+
+#ifdef WTHTTP_WITH_ZLIB
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+#include <zlib.h>
+
+namespace http {
+namespace server {
+
+/// A zlib deflate stream, together with buffers for its output.
+/*
+ * Setting up a deflate stream allocates and initializes some 256kB of
+ * state, which for a small response costs more than compressing it.
+ * Contexts are therefore reused, see DeflatePool.
+ */
+class DeflateContext : private boost::noncopyable
+{
+public:
+  static const std::size_t BLOCK_SIZE = 16 * 1024;
+
+  /// The format of the compressed data.
+  enum Format {
+    Gzip, //!< gzip, for the Content-Encoding
+    Raw   //!< raw deflate, for WebSocket permessage-deflate
+  };
+
+  DeflateContext();
+  ~DeflateContext();
+
+  z_stream stream;
+
+  /// Returns output block i (of BLOCK_SIZE bytes).
+  /*
+   * The blocks remain valid until the context is released, so that
+   * the output can be written from them directly.
+   */
+  unsigned char *block(unsigned i);
+
+private:
+  bool initialized_;
+  Format format_;
+  int level_;
+  std::vector<unsigned char *> blocks_;
+
+  friend class DeflatePool;
+};
+
+/// A per-thread pool of deflate contexts.
+class DeflatePool
+{
+public:
+  /// Returns a deflate context, with the given compression level.
+  /*
+   * Returns 0 if zlib could not be initialized.
+   */
+  static DeflateContext *acquire(int level,
+				 DeflateContext::Format format
+				   = DeflateContext::Gzip);
+
+  /// Returns a context to the pool of the current thread.
+  static void release(DeflateContext *context);
+};
+
+} // namespace server
+} // namespace http
+
+#endif // WTHTTP_WITH_ZLIB
+
+#endif // HTTP_DEFLATE_POOL_HPP
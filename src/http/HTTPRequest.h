@@ -29,6 +29,8 @@ public:
   virtual std::istream& in() { return reply_->in(); }
   virtual std::ostream& out() { return reply_->out(); }
   virtual std::ostream& err() { return std::cerr; }
+  virtual bool sendFile(const std::string& fileName,
+			::int64_t offset, ::int64_t length);
 
   virtual void setStatus(int status);
   virtual void setContentLength(::int64_t length);
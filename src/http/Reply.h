@@ -34,9 +34,6 @@ namespace asio = boost::asio;
 #include <boost/enable_shared_from_this.hpp>
 
 #include <boost/tuple/tuple.hpp>
-#ifdef WTHTTP_WITH_ZLIB
-#include <zlib.h>
-#endif
 
 #include "Wt/WLogger"
 
@@ -49,6 +46,7 @@ namespace server {
 
 class Configuration;
 class Connection;
+class DeflateContext;
 class Reply;
 
 typedef boost::shared_ptr<Connection> ConnectionPtr;
@@ -102,17 +100,37 @@ public:
 			   Buffer::const_iterator end,
 			   Request::State state) = 0;
 
-  virtual void consumeWebSocketMessage(ws_opcode opcode,
+  /*
+   * compressed indicates a message compressed with permessage-deflate
+   */
+  virtual void consumeWebSocketMessage(ws_opcode opcode, bool compressed,
 				       Buffer::const_iterator begin,
 				       Buffer::const_iterator end,
 				       Request::State state);
 
   void setConnection(ConnectionPtr connection);
+
+  /*
+   * Keeps the request alive for as long as this reply, which refers to
+   * it: the connection reuses a request only once its reply has been
+   * released.
+   */
+  void holdRequest(RequestPtr request) { heldRequest_ = request; }
+
   bool nextBuffers(std::vector<asio::const_buffer>& result);
+
+  /*
+   * Returns a file descriptor and range when the remaining content
+   * can be transmitted unmodified from a file, e.g. using sendfile().
+   * This is only possible once the headers have been sent, and not
+   * when the content needs to be encoded (gzip or chunked).
+   */
+  bool nextFileContent(int& fd, ::int64_t& offset, ::int64_t& length);
   bool closeConnection() const;
   void setCloseConnection() { closeConnection_ = true; }
 
-  void addHeader(const std::string name, const std::string value);
+  void addHeader(const std::string& name, const std::string& value);
+  void addHeader(const char *name, const char *value);
 
   virtual bool waitMoreData() const { return false; }
   void send();
@@ -123,6 +141,14 @@ public:
   void setStatus(status_type status);
   status_type status() const { return status_; }
 
+  static std::string httpDate(time_t t);
+
+  /// Formats a date into buf (at least 30 chars), returns its length
+  static unsigned httpDate(time_t t, char *buf);
+
+  /// Returns whether content of this type benefits from gzip compression
+  static bool isCompressible(const char *contentType);
+
 protected:
   const Request& request_;
   const Configuration& configuration_;
@@ -131,23 +157,42 @@ protected:
   std::string requestUri_;
   int requestMajor_, requestMinor_;
 
-  virtual std::string contentType() = 0;
-  virtual std::string location();
+  virtual const char *contentType() = 0;
+  virtual const char *location();
   virtual ::int64_t contentLength() = 0;
 
+  /*
+   * Returns the size of the content when it is already complete,
+   * although contentLength() is -1 (unknown), or -1 otherwise. This is
+   * used to decide whether compression is worth it. The default
+   * implementation returns -1.
+   */
+  virtual ::int64_t completeContentLength();
+
   virtual void nextContentBuffers(std::vector<asio::const_buffer>& result) = 0;
 
-  void setRelay(ReplyPtr reply);
+  /*
+   * Provides the remaining content as a file range, instead of through
+   * nextContentBuffers(). This is asked only as long as no content
+   * has been sent. The default implementation returns false.
+   */
+  virtual bool fileContent(int& fd, ::int64_t& offset, ::int64_t& length);
 
-  static std::string httpDate(time_t t);
+  void setRelay(ReplyPtr reply);
 
   ConnectionPtr getConnection() { return connection_.lock(); }
   bool transmitting() const { return transmitting_; }
 
 private:
-  std::vector<std::pair<std::string, std::string> > headers_;
+  /*
+   * The headers, formatted as they are sent, in memory from the arena
+   * of the connection.
+   */
+  std::vector<char, ArenaAllocator<char> > headers_;
+  bool haveContentEncoding_;
 
   ConnectionWeakPtr connection_;
+  RequestPtr heldRequest_;
 
   status_type status_;
   bool transmitting_;
@@ -159,18 +204,18 @@ private:
   ::int64_t contentOriginalSize_;
 
   ReplyPtr relay_;
-  std::list<std::string> bufs_;
 
   char gather_buf_[100];
 
-  asio::const_buffer buf(const std::string s);
+  void appendHeader(const char *name, std::size_t nameLength,
+		    const char *value, std::size_t valueLength);
 
   void encodeNextContentBuffer(std::vector<asio::const_buffer>& result,
 			       int& originalSize, int& encodedSize);
 #ifdef WTHTTP_WITH_ZLIB
-  void initGzip();
-  bool gzipBusy_;
-  z_stream gzipStrm_;
+  DeflateContext *gzip_;
+  void gzipDeflate(int flush, std::vector<asio::const_buffer>& result,
+		   int& encodedSize, unsigned& block);
 #endif
 };
 
@@ -18,14 +18,16 @@
 #define HTTP_REQUEST_HPP
 
 #include <string>
-#include <map>
 #include <vector>
 #include <boost/cstdint.hpp>
 #include <boost/algorithm/string.hpp>
+#include <boost/shared_ptr.hpp>
 
 // For ::int64_ and ::uint64_t on Windows only
 #include "Wt/WDllDefs.h"
 
+#include "Arena.h"
+
 #ifdef HTTP_WITH_SSL
 #include <openssl/ssl.h>
 #endif
@@ -37,20 +39,6 @@ namespace Wt {
 namespace http {
 namespace server {
 
-/*
- * boost::is_iless throws bad_cast -- here is my ad hoc version.
- */
-struct my_iless
-{
-  bool operator()(const std::string& a, const std::string& b) const {
-#if defined(WIN32) && !defined(__CYGWIN__)
-    return _stricmp(a.c_str(), b.c_str()) < 0;
-#else
-    return strcasecmp(a.c_str(), b.c_str()) < 0;
-#endif
-  }
-};
-
 /// A request received from a client.
 /// A request with a body will have a content-length.
 class Request
@@ -66,31 +54,80 @@ public:
   int http_version_major;
   int http_version_minor;
 
-  typedef std::map<std::string, std::string, my_iless> HeaderMap;
-  HeaderMap headerMap;
-  std::vector<HeaderMap::iterator> headerOrder;
+  /*
+   * The request line and headers are kept as received in
+   * headerBuffer. A header refers to its name and value as offsets
+   * into this buffer, so that parsing a request does not allocate
+   * per header; a value is only copied into a string when it is
+   * asked for (getHeader()). The buffer keeps its capacity across
+   * keep-alive requests.
+   */
+  struct Header {
+    unsigned nameBegin, nameLength;
+    unsigned valueBegin, valueLength;
+  };
+  typedef std::vector<Header> HeaderList;
+
+  std::vector<char> headerBuffer;
+  HeaderList headers;
+
   ::int64_t contentLength;
   int webSocketVersion;
 
+  /*
+   * Whether the permessage-deflate extension (RFC 7692) was
+   * negotiated for a WebSocket connection, and whether the server
+   * then needs to reset its compression context after each message.
+   */
+  bool webSocketDeflate;
+  bool webSocketDeflateNoContextTakeover;
+
   std::string request_path;
   std::string request_query;
   std::string request_extra_path;
 
+  /// For a static file: its path in the docroot
+  std::string file_path;
+
 #ifdef HTTP_WITH_SSL
   SSL *ssl;
 #endif
   Wt::WSslInfo *sslInfo() const;
 
+  /// The arena of the connection, from which replies are allocated
+  ArenaPtr arena; // not cleared by reset()
+
   void reset();
 
   bool closeConnection() const;
   bool acceptGzipEncoding() const;
   void enableWebSocket();
+
+  /// Returns the first header with the given name, or 0
+  const Header *findHeader(const char *name) const;
+
+  /// Returns the value of a header, or an empty string
   std::string getHeader(const std::string& name) const;
 
+  /// Returns whether a header has exactly the given value
+  bool headerEquals(const char *name, const std::string& value) const;
+
+  /// Returns whether a header value equals value, ignoring case
+  bool headerIEquals(const char *name, const char *value) const;
+
+  /// Returns whether a header value contains value, ignoring case
+  bool headerIContains(const char *name, const char *value) const;
+
+  const char *headerName(const Header& h) const
+    { return &headerBuffer[0] + h.nameBegin; }
+  const char *headerValue(const Header& h) const
+    { return &headerBuffer[0] + h.valueBegin; }
+
   void transmitHeaders(std::ostream& out) const;
 };
 
+typedef boost::shared_ptr<Request> RequestPtr;
+
 } // namespace server
 } // namespace http
 
@@ -24,6 +24,7 @@
 
 #include "Configuration.h"
 #include "Reply.h"
+#include "StaticFileCache.h"
 #include "../web/Configuration.h"
 
 namespace http {
@@ -40,7 +41,10 @@ public:
   /// Construct with a directory containing files to be served.
   explicit RequestHandler(const Configuration &config,
 			  const Wt::EntryPointList& entryPoints,
-			  Wt::WLogger& logger);
+			  Wt::WLogger& logger,
+			  asio::io_service& ioService);
+
+  ~RequestHandler();
 
   /// Handle a request and produce a reply.
   ReplyPtr handleRequest(Request& req);
@@ -52,6 +56,9 @@ public:
 
   Wt::WLogger& logger() const { return logger_; }
 
+  /// The cache for static files, or 0 if disabled
+  StaticFileCache *staticFileCache() const { return staticFileCache_.get(); }
+
 private:
   /// The server configuration
   const Configuration &config_;
@@ -59,16 +66,22 @@ private:
   const Wt::EntryPointList& entryPoints_;
   /// The logger
   Wt::WLogger& logger_;
+  /// The static file cache, if enabled
+  StaticFileCachePtr staticFileCache_;
+
+  ReplyPtr stockReply(Request& req, Reply::status_type status);
 
   /// Perform URL-decoding on a string and separates in path and
   /// query. Returns false if the encoding was invalid.
   static bool url_decode(const std::string& in, std::string& path,
 			 std::string& query);
 
+  /// Returns whether path matches prefix, and where the rest of the
+  /// path begins.
   static bool matchesPath(const std::string& path,
 			  const std::string& prefix,
 			  bool matchAfterSlash,
-			  std::string& rest);
+			  std::size_t& restBegin);
 
 };
 
@@ -54,10 +54,22 @@ public:
 
   bool initialState() const;
 
+  /// Unmasks (a part of) a WebSocket payload.
+  /*
+   * offset is the offset in the (network order) mask of the first
+   * byte, and is updated for the next part of the payload. The
+   * payload is unmasked a word at a time.
+   */
+  static void unmask(char *begin, char *end, ::uint32_t mask,
+		     unsigned char& offset);
+
 
 private:
-  /// Handle the next character of input.
-  boost::tribool& consume(Request& req, char input);
+  /// Parse the request line and headers collected in req.headerBuffer.
+  bool parseHeaders(Request& req);
+
+  /// Parse the request line.
+  bool parseRequestLine(Request& req, const char *begin, const char *end);
 
   /// Check if a byte is an HTTP character.
   static bool is_char(int c);
@@ -71,9 +83,8 @@ private:
   /// Check if a byte is a digit.
   static bool is_digit(int c);
 
-  bool consumeChar(char input);
-  void consumeToString(std::string& result, int maxSize);
-  void consumeComplete();
+  /// Check if a byte may be part of a token (method, header name).
+  static bool is_token(int c);
 
   Request::State parseWebSocketMessage(Request& req, ReplyPtr reply,
 				       Buffer::iterator& begin,
@@ -81,6 +92,7 @@ private:
 
   bool doWebSocketHandshake00(const Request& req);
   std::string doWebSocketHandshake13(const Request& req);
+  std::string doWebSocketDeflateNegotiation(Request& req);
   bool parseCrazyWebSocketKey(const std::string& key, ::uint32_t& number);
 
   Server *server_;
@@ -90,26 +102,8 @@ private:
   {
     method_start,
     expecting_newline_0,
-    method,
-    uri_start,
-    uri,
-    http_version_h,
-    http_version_t_1,
-    http_version_t_2,
-    http_version_p,
-    http_version_slash,
-    http_version_major_start,
-    http_version_major,
-    http_version_minor_start,
-    http_version_minor,
-    expecting_newline_1,
-    header_line_start,
-    header_lws,
-    header_name,
-    space_before_header_value,
-    header_value,
-    expecting_newline_2,
-    expecting_newline_3
+    request_header,
+    request_complete
   } httpState_;
 
   enum ws_state {
@@ -131,18 +125,11 @@ private:
   unsigned char wsCount_;
   unsigned wsMask_;
 
-  std::string  headerName_;
-  std::string  headerValue_;
-
-  ::uint64_t   requestSize_;
-
   // used for HTTP POST body and ws frame/payload length
   ::int64_t    remainder_;
 
-  char         buf_[4096];
-  unsigned     buf_ptr_;
-  std::string *dest_;
-  unsigned     maxSize_;
+  // used for the ws00 handshake nonce
+  char         buf_[16];
 };
 
 } // namespace server
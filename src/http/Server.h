@@ -24,7 +24,9 @@ namespace asio = boost::asio;
 #endif // HTTP_WITH_SSL
 
 #include <string>
+#include <vector>
 #include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <boost/version.hpp>
 
 #include "TcpConnection.h"
@@ -39,6 +41,10 @@ namespace asio = boost::asio;
 
 #include "Wt/WLogger"
 
+namespace boost {
+  class thread;
+}
+
 namespace http {
 namespace server {
 
@@ -74,14 +80,69 @@ public:
   asio::io_service &service();
 
 private:
+  /*
+   * An I/O reactor: an io_service together with the acceptors that
+   * feed it and the connections it serves.
+   *
+   * By default, there is a single reactor which uses the WIOService
+   * thread pool. When configured with --reactors, each reactor owns
+   * an io_service which is run by a single thread, and listens on its
+   * own SO_REUSEPORT socket. A connection then lives and dies on the
+   * thread of the reactor that accepted it.
+   */
+  struct Reactor : private boost::noncopyable
+  {
+    Reactor(asio::io_service *ownService, asio::io_service& sharedService);
+    ~Reactor();
+
+    /// The io_service owned by this reactor, or 0 when shared
+    boost::scoped_ptr<asio::io_service> ownService_;
+
+    /// The io_service which serves this reactor
+    asio::io_service& service_;
+
+    /// Keeps an owned io_service running
+    asio::io_service::work *work_;
+
+    /// The thread running an owned io_service
+    boost::thread *thread_;
+
+    /// The strand for handleTcpAccept(), handleSslAccept() and handleStop()
+    asio::strand accept_strand_;
+
+    /// Acceptor used to listen for incoming http connections.
+    asio::ip::tcp::acceptor tcp_acceptor_;
+
+#ifdef HTTP_WITH_SSL
+    /// Acceptor used to listen for incoming https connections
+    asio::ip::tcp::acceptor ssl_acceptor_;
+
+    /// The next SSL connection to be accepted.
+    SslConnectionPtr new_sslconnection_;
+#endif // HTTP_WITH_SSL
+
+    /// The connection manager which owns all live connections.
+    ConnectionManager connection_manager_;
+
+    /// The next TCP connection to be accepted.
+    TcpConnectionPtr new_tcpconnection_;
+  };
+
+  /// Starts the threads of reactors that own their io_service
+  void startReactors();
+
+  /// Opens, binds and listens an acceptor
+  void listen(asio::ip::tcp::acceptor& acceptor,
+	      asio::ip::tcp::endpoint& endpoint);
+
   /// Starts accepting http/https connections
-  void startAccept();
+  void startAccept(Reactor *reactor);
 
   /// Handle completion of an asynchronous accept operation.
-  void handleTcpAccept(const asio_error_code& e);
+  void handleTcpAccept(Reactor *reactor, const asio_error_code& e);
 
   /// Handle a request to stop the server.
-  void handleStop();
+  void handleStop(Reactor *reactor);
 
   /// Handle a request to resume the server.
   void handleResume();
@@ -95,39 +156,21 @@ private:
   /// The logger
   Wt::WLogger accessLogger_;
 
-  /// The strand for handleTcpAccept(), handleSslAccept() and handleStop()
-  asio::strand accept_strand_;
-
-  /// The strand for schedule()
-  // asio::strand schedule_strand_;
-
-  /// Acceptor used to listen for incoming http connections.
-  asio::ip::tcp::acceptor tcp_acceptor_;
+  /// The reactors
+  std::vector<Reactor *> reactors_;
 
 #ifdef HTTP_WITH_SSL
   /// Ssl context information
   asio::ssl::context ssl_context_;
 
-  /// Acceptor used to listen for incoming https connections
-  asio::ip::tcp::acceptor ssl_acceptor_;
-
   /// Handle completion of an asynchronous SSL accept operation.
-  void handleSslAccept(const asio_error_code& e);
-
-  /// The next SSL connection to be accepted.
-  SslConnectionPtr new_sslconnection_;
+  void handleSslAccept(Reactor *reactor, const asio_error_code& e);
 #endif // HTTP_WITH_SSL
 
 void handleTimeout(asio::deadline_timer *timer,
 		   const boost::function<void ()>& function,
 		   const asio_error_code& err);
 
-  /// The connection manager which owns all live connections.
-  ConnectionManager connection_manager_;
-
-  /// The next TCP connection to be accepted.
-  TcpConnectionPtr new_tcpconnection_;
-
   /// The handler for all incoming requests.
   RequestHandler request_handler_;
 };
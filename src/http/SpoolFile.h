@@ -0,0 +1,72 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * All rights reserved.
+ */
+#ifndef HTTP_SPOOL_FILE_HPP
+#define HTTP_SPOOL_FILE_HPP
+
+#include <cstddef>
+#include <istream>
+#include <streambuf>
+
+#include <boost/noncopyable.hpp>
+
+namespace http {
+namespace server {
+
+/// A temporary file in which a large request body is spooled.
+/*
+ * The body is appended to the file while it is being received, using
+ * a single file descriptor that is kept open until the request has
+ * been handled. Small writes are collected in a buffer, which is
+ * written together with the next write that does not fit (writev()).
+ *
+ * The file has no name: on Linux it is created with O_TMPFILE if the
+ * file system supports it, otherwise it is unlinked right after it
+ * has been created. It is removed when the descriptor is closed.
+ *
+ * Once the body has been received, it is read back through in().
+ */
+class SpoolFile : public std::streambuf, private boost::noncopyable
+{
+public:
+  SpoolFile();
+  ~SpoolFile();
+
+  /// Creates the file, returns whether successful.
+  bool open();
+
+  bool isOpen() const { return fd_ != -1; }
+
+  /// Appends data, returns whether successful.
+  bool write(const char *data, std::size_t size);
+
+  /// Writes buffered data to the file, returns whether successful.
+  bool flush();
+
+  /// A stream for reading the file contents (after flush()).
+  std::istream& in() { return in_; }
+
+protected:
+  virtual int_type underflow();
+  virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+			   std::ios_base::openmode which);
+  virtual pos_type seekpos(pos_type pos, std::ios_base::openmode which);
+
+private:
+  static const std::size_t BUF_SIZE = 64 * 1024;
+
+  int fd_;
+  char *buf_;
+  std::size_t buffered_;
+  std::istream in_;
+
+  bool writeOut(const char *data, std::size_t size);
+};
+
+} // namespace server
+} // namespace http
+
+#endif // HTTP_SPOOL_FILE_HPP
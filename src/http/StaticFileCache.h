@@ -0,0 +1,127 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * All rights reserved.
+ */
+#ifndef HTTP_STATIC_FILE_CACHE_HPP
+#define HTTP_STATIC_FILE_CACHE_HPP
+
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/scoped_ptr.hpp>
+#ifdef WT_THREADED
+#include <boost/thread/mutex.hpp>
+#endif // WT_THREADED
+
+namespace asio = boost::asio;
+
+namespace http {
+namespace server {
+
+/// An in-memory cache of static files.
+/*
+ * Files are kept, together with a gzip compressed variant and their
+ * Last-Modified and ETag headers, up to a maximum total size, evicting
+ * the least recently used files first.
+ *
+ * On Linux, entries are invalidated using inotify, watching the
+ * directories of the cached files, so that a hit needs no system call
+ * at all. Elsewhere, a hit is validated by checking the file's size and
+ * modification time.
+ */
+class StaticFileCache
+  : public boost::enable_shared_from_this<StaticFileCache>,
+    private boost::noncopyable
+{
+public:
+  /// The file contents as is, or gzip compressed.
+  struct Variant {
+    std::string data;
+    std::string etag;
+  };
+
+  /// A cached file.
+  struct Entry {
+    std::string path;
+    std::string lastModified;
+    time_t modifiedTime;
+    Variant plain;
+    Variant gzip; // data is empty if there is no compressed variant
+    std::size_t size() const;
+  };
+
+  typedef boost::shared_ptr<const Entry> EntryPtr;
+
+  /// Construct a cache of at most maxSize bytes.
+  StaticFileCache(asio::io_service& ioService, ::int64_t maxSize);
+
+  ~StaticFileCache();
+
+  /// Returns the file at path, reading it if it is not yet cached.
+  /*
+   * Returns 0 if the file does not exist or is too large to be
+   * cached (more than 1/8th of the cache size).
+   */
+  EntryPtr get(const std::string& path, const std::string& extension);
+
+  /// Stop watching for changes, and clear the cache.
+  void stop();
+
+  /// The total size of the cached entries.
+  ::int64_t size() const { return size_; }
+
+private:
+  typedef std::list<EntryPtr> LruList;
+  typedef std::map<std::string, LruList::iterator> EntryMap;
+
+  ::int64_t maxSize_, size_;
+
+  LruList lru_; // most recently used first
+  EntryMap entries_;
+
+  /// Incremented on every invalidation, to detect changes while loading
+  unsigned generation_;
+
+#ifdef WT_THREADED
+  boost::mutex mutex_;
+#endif // WT_THREADED
+
+  EntryPtr load(const std::string& path, const std::string& extension,
+		time_t modifiedTime, ::int64_t fileSize);
+  bool isCurrent(const Entry& entry) const;
+
+  void insert(EntryPtr entry);
+  void remove(EntryMap::iterator i);
+  void invalidate(const std::string& path);
+  void invalidateDirectory(const std::string& dir);
+
+#ifdef __linux__
+  boost::scoped_ptr<asio::posix::stream_descriptor> inotify_;
+  std::map<int, std::vector<std::string> > watches_;
+  std::map<std::string, int> watchedDirs_;
+  std::vector<char> eventBuf_;
+
+  bool watch(const std::string& dir);
+  void startReadEvents();
+  void handleEvents(const boost::system::error_code& e,
+		    std::size_t bytes_transferred);
+#endif // __linux__
+
+  bool watching() const;
+};
+
+typedef boost::shared_ptr<StaticFileCache> StaticFileCachePtr;
+
+} // namespace server
+} // namespace http
+
+#endif // HTTP_STATIC_FILE_CACHE_HPP
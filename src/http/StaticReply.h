@@ -21,9 +21,11 @@
 #include <vector>
 #include <fstream>
 #include <boost/asio.hpp>
+#include <boost/scoped_array.hpp>
 namespace asio = boost::asio;
 
 #include "Reply.h"
+#include "StaticFileCache.h"
 
 namespace http {
 namespace server {
@@ -35,29 +37,39 @@ class StaticReply : public Reply
 {
 public:
   StaticReply(const std::string &full_path, const std::string &extension,
-	      const Request& request, const Configuration& configuration);
+	      const Request& request, const Configuration& configuration,
+	      StaticFileCache::EntryPtr cached = StaticFileCache::EntryPtr());
+  virtual ~StaticReply();
 
   virtual void consumeData(Buffer::const_iterator begin,
 			   Buffer::const_iterator end,
 			   Request::State state);
 
 protected:
-  virtual std::string contentType();
+  virtual const char *contentType();
   virtual ::int64_t contentLength();
 
   virtual void nextContentBuffers(std::vector<asio::const_buffer>& result);
+  virtual bool fileContent(int& fd, ::int64_t& offset, ::int64_t& length);
 
 private:
   std::string     path_;
   std::string     extension_;
   std::ifstream   stream_;
+  int             fd_;
+
+  /// When served from the cache: the entry and variant that is sent
+  StaticFileCache::EntryPtr cached_;
+  const StaticFileCache::Variant *variant_;
+  ::int64_t position_;
   ::int64_t fileSize_;
 
-  char buf_[64 * 1024];
+  /// Buffer for reading from stream_, allocated only when needed
+  static const int BUF_SIZE = 64 * 1024;
+  boost::scoped_array<char> buf_;
 
   std::string computeModifiedDate() const;
   std::string computeETag() const;
-  static std::string computeExpires();
 
   void parseRangeHeader();
   bool hasRange_;
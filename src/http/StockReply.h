@@ -43,7 +43,7 @@ public:
 			   Request::State state);
 
 protected:
-  virtual std::string contentType();
+  virtual const char *contentType();
   virtual ::int64_t contentLength();
 
   virtual void nextContentBuffers(std::vector<asio::const_buffer>& result);
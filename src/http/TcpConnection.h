@@ -47,14 +47,26 @@ public:
   virtual void stop();
   virtual std::string urlScheme() { return "http"; }
 
+  virtual bool canSendFile() const;
+
 protected:
   virtual void startAsyncReadRequest(Buffer& buffer, int timeout);
   virtual void startAsyncReadBody(Buffer& buffer, int timeout);
   virtual void startAsyncWriteResponse
       (const std::vector<asio::const_buffer>& buffers, int timeout);
+  virtual void startAsyncSendFile(int fd, ::int64_t offset, ::int64_t length,
+				  int timeout);
 
   /// Socket for the connection.
   asio::ip::tcp::socket socket_;
+
+private:
+  /// File range that is being sent using sendfile()
+  int sendFileFd_;
+  ::int64_t sendFileOffset_, sendFileRemaining_;
+  int sendFileTimeout_;
+
+  void handleSendFile(const asio_error_code& e);
 };
 
 typedef boost::shared_ptr<TcpConnection> TcpConnectionPtr;
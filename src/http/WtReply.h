@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "Reply.h"
+#include "DeflatePool.h"
 #include "../web/Configuration.h"
 
 namespace http {
@@ -20,6 +21,8 @@ namespace server {
 
 class StockReply;
 class HTTPRequest;
+class SpoolFile;
+class Server;
 class WtReply;
 class Configuration;
 
@@ -39,7 +42,7 @@ public:
 			   Buffer::const_iterator end,
 			   Request::State state);
 
-  virtual void consumeWebSocketMessage(ws_opcode opcode,
+  virtual void consumeWebSocketMessage(ws_opcode opcode, bool compressed,
 				       Buffer::const_iterator begin,
 				       Buffer::const_iterator end,
 				       Request::State state);
@@ -47,6 +50,8 @@ public:
   void setContentLength(::int64_t length);
   void setContentType(const std::string& type);
   void setLocation(const std::string& location);
+  bool sendFile(const std::string& fileName,
+		::int64_t offset, ::int64_t length);
   void send(CallbackFunction callBack, bool responseComplete);
   void readWebSocketMessage(CallbackFunction callBack);
   bool readAvailable();
@@ -60,30 +65,57 @@ public:
 
 protected:
   const Wt::EntryPoint& entryPoint_;
-  std::iostream *in_;
+  std::istream *in_;
   std::stringstream in_mem_;
-  std::string requestFileName_;
+  SpoolFile *spool_;
   boost::asio::streambuf out_buf_;
   std::ostream out_;
   std::string contentType_;
   std::string location_;
   std::string urlScheme_;
   std::size_t sending_;
-  ::int64_t contentLength_, bodyReceived_;
+  ::int64_t contentLength_, bodyReceived_, progressReported_;
+  unsigned partsReported_;
   bool sendingMessages_;
   CallbackFunction  fetchMoreDataCallback_, readMessageCallback_;
   HTTPRequest *httpRequest_;
 
   char gatherBuf_[16];
 
-  virtual std::string     contentType();
-  virtual std::string     location();
+  virtual const char     *contentType();
+  virtual const char     *location();
   virtual ::int64_t       contentLength();
+  virtual ::int64_t       completeContentLength();
 
   virtual void nextContentBuffers(std::vector<asio::const_buffer>& result);
+  virtual bool fileContent(int& fd, ::int64_t& offset, ::int64_t& length);
 
 private:
+  int fileFd_;
+  ::int64_t fileOffset_, fileLength_;
+
+#ifdef WTHTTP_WITH_ZLIB
+  /*
+   * With permessage-deflate, the compression and decompression
+   * contexts of the messages, which are kept for the whole
+   * connection unless there is no context takeover.
+   */
+  DeflateContext *wsDeflate_;
+  z_stream wsInflate_;
+  bool wsInflateInitialized_, wsInflateError_;
+  ::int64_t wsInflated_;
+
+  bool deflateWebSocketMessage(std::vector<asio::const_buffer>& result,
+			       std::size_t& size);
+  bool inflateWebSocketMessage(Buffer::const_iterator begin,
+			       Buffer::const_iterator end);
+#endif // WTHTTP_WITH_ZLIB
+
   void readRestWebSocketHandshake();
+  void prepareRequestBody(Server *server);
+  bool reportProgress(Request::State state);
+  void dispatchRequest(ConnectionPtr connection);
+  void handleRequest();
 
   void consumeRequestBody(Buffer::const_iterator begin,
 			  Buffer::const_iterator end,
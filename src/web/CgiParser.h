@@ -18,6 +18,7 @@
 namespace Wt {
 
 class CgiParser;
+class MultipartParser;
 class WebRequest;
 
 /*
@@ -28,8 +29,6 @@ class CgiParser
 public:
   enum ReadOption { ReadDefault, ReadHeadersOnly, ReadBodyAnyway };
 
-  static void init();
-
   CgiParser(::int64_t maxPostData);
 
   /*
@@ -42,26 +41,12 @@ public:
 private:
   void readMultipartData(WebRequest& request, const std::string type,
 			 ::int64_t len);
-  bool parseBody(WebRequest& request, const std::string boundary);
-  bool parseHead(WebRequest& request);
-  ::int64_t maxPostData_, left_;
-  std::ostream *spoolStream_;
-  WebRequest *request_;
-
-  std::string currentKey_;
+  void addMultipartData(WebRequest& request, MultipartParser& parser);
 
-  void readUntilBoundary(WebRequest& request, const std::string boundary,
-			 int tossAtBoundary,
-			 std::string *resultString,
-			 std::ostream *resultFile);
-  void windBuffer(int offset);
-  int index(const std::string search);
+  ::int64_t maxPostData_;
+  WebRequest *request_;
 
   enum {BUFSIZE = 8192};
-  enum {MAXBOUND = 100};
-
-  int buflen_;
-  static char buf_[BUFSIZE + MAXBOUND];
 };
 
 }
@@ -156,6 +156,7 @@ public:
   float maxPlainSessionsRatio() const;
   bool ajaxPuzzle() const;
   bool sessionIdCookie() const;
+  int recursiveEventLoopStackSize() const;
   bool useSlashExceptionForInternalPaths() const;
   bool needReadBodyBeforeResponse() const;
 
@@ -219,6 +220,7 @@ private:
   float           maxPlainSessionsRatio_;
   bool            ajaxPuzzle_;
   bool            sessionIdCookie_;
+  int             recursiveEventLoopStackSize_;
 
   bool connectorSlashException_;
   bool connectorNeedReadBody_;
@@ -0,0 +1,102 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_COROUTINE_H_
+#define WT_COROUTINE_H_
+
+#include <cstddef>
+
+#include <ucontext.h>
+
+#if __cplusplus >= 201103L
+#include <exception>
+#else
+#include <boost/exception_ptr.hpp>
+#endif
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <Wt/WDllDefs.h>
+
+namespace Wt {
+
+/*
+ * A function that runs on its own stack, and which may suspend itself
+ * to be resumed later, from the same or another thread.
+ *
+ * Once recursive event loops are used, this is used to run the
+ * requests and events of a session, so that a recursive event loop
+ * (WDialog::exec()) can suspend the request that started it,
+ * releasing its thread, instead of blocking the thread until the
+ * next request for the session arrives.
+ *
+ * Stacks are reserved with mmap() and only take memory for the pages
+ * that are used, and are reused from a pool.
+ */
+class WT_API Coroutine : private boost::noncopyable
+{
+public:
+  Coroutine(const boost::function<void ()>& function, std::size_t stackSize);
+
+  /*
+   * A suspended coroutine is unwound first: suspend() then throws, so
+   * that the objects on its stack are destroyed.
+   */
+  ~Coroutine();
+
+  /*
+   * Runs the coroutine until it suspends itself or returns. Returns
+   * whether it has returned.
+   *
+   * An exception that escapes the function is rethrown here, in the
+   * context that resumed it.
+   */
+  bool resume();
+
+  bool done() const { return done_; }
+
+  /*
+   * Suspends the current coroutine, returning from resume().
+   *
+   * When the coroutine is destroyed instead of resumed, this throws
+   * an exception that only the coroutine itself catches.
+   */
+  static void suspend();
+
+  /*
+   * Returns the coroutine that is running in this thread, or 0.
+   */
+  static Coroutine *current();
+
+private:
+  /*
+   * boost::current_exception() only keeps the type of an exception
+   * thrown with boost::throw_exception() or of a standard exception
+   * type, and C++98 has no other way to carry an exception.
+   */
+#if __cplusplus >= 201103L
+  typedef std::exception_ptr ExceptionPtr;
+#else
+  typedef boost::exception_ptr ExceptionPtr;
+#endif
+
+  struct Unwind { };
+
+  boost::function<void ()> function_;
+  ucontext_t context_, caller_;
+  char *stack_;
+  std::size_t stackSize_;
+  bool started_, done_, unwinding_;
+  Coroutine *prev_;
+  ExceptionPtr exception_;
+
+  static void entry(unsigned hi, unsigned lo);
+  void run();
+};
+
+}
+
+#endif // WT_COROUTINE_H_
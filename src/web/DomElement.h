@@ -248,6 +248,8 @@ private:
   void processProperties(WApplication *app) const;
   void setJavaScriptProperties(EscapeOStream& out, WApplication *app) const;
   void setJavaScriptAttributes(EscapeOStream& out) const;
+  bool canWriteCompactUpdate(WApplication *app) const;
+  void setCompactUpdate(EscapeOStream& out, WApplication *app) const;
   void setJavaScriptEvent(EscapeOStream& out, const char *eventName,
 			  const EventHandler& handler, WApplication *app) const;
   void createElement(EscapeOStream& out, WApplication *app,
@@ -9,7 +9,9 @@
 
 #include <string>
 #include <iostream>
-#include <map>
+#include <vector>
+
+#include <Wt/WDllDefs.h>
 
 namespace Wt {
 
@@ -26,11 +28,21 @@ namespace Wt {
  *  _$_$ifnot_condition_$_;
  *     ...
  *  _$_$endif_$_;
+ *
+ * Variables and conditions within a block that is not streamed need
+ * not be set.
+ *
+ * A template is parsed only once, into a list of literal text,
+ * variables and conditional blocks, which is shared by all instances
+ * for the same template. The contents must therefore be static: the
+ * parsed template is found using the address of the contents (of the
+ * first part).
  */
-class FileServe
+class WT_API FileServe
 {
 public:
   FileServe(const char *contents);
+  FileServe(const std::vector<const char *>& parts);
 
   void setVar(const std::string& name, const std::string& value);
   void setVar(const std::string& name, const char *value);
@@ -41,11 +53,14 @@ public:
   void stream(std::ostream& out);
   void streamUntil(std::ostream& out, const std::string& until);
 
+  struct Template;
+
 private:
-  const char *template_;
-  int currentPos_;
-  std::map<std::string, std::string> vars_;
-  std::map<std::string, bool> conditions_;
+  const Template *template_;
+  std::size_t currentSegment_;
+  std::vector<std::string> vars_;
+  std::vector<bool> varsSet_;
+  std::vector<int> conditions_;
 };
 
 }
@@ -29,6 +29,9 @@ namespace Wt {
     extern std::string leaf(const std::string &file);
     
 
+    // Returns the directory in which temporary files are created
+    extern WT_API std::string getTempDir();
+
     // Returns a filename that can be used as temporary file
     extern WT_API std::string createTempFileName();
 
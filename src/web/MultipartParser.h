@@ -0,0 +1,111 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef MULTIPART_PARSER_H_
+#define MULTIPART_PARSER_H_
+
+#include <fstream>
+#include <string>
+
+#include <boost/cstdint.hpp>
+
+#include <Wt/WDllDefs.h>
+#include "Wt/Http/Request"
+
+namespace Wt {
+
+/*
+ * An incremental parser for a multipart/form-data request body.
+ *
+ * The body may be fed in pieces of any size, as it is received. Form
+ * fields are collected as parameters, and file parts are written to
+ * a spool file as they are parsed, which are collected as uploaded
+ * files.
+ *
+ * Boundaries are found using the Boyer-Moore-Horspool algorithm,
+ * which skips through the data of a part without looking at most of
+ * its bytes.
+ */
+class WT_API MultipartParser
+{
+public:
+  /*
+   * Finds the boundary in the value of a multipart Content-Type
+   * header. Returns false if there is none.
+   */
+  static bool boundary(const std::string& contentType, std::string& result);
+
+  MultipartParser(const std::string& boundary);
+
+  /*
+   * Parses more of the body, returns false if the body is not valid.
+   */
+  bool parse(const char *begin, const char *end);
+
+  /*
+   * Returns whether the last boundary has been parsed.
+   */
+  bool done() const { return state_ == Done; }
+
+  const std::string& error() const { return error_; }
+
+  /*
+   * The number of parts that have been parsed completely.
+   */
+  unsigned partsCompleted() const { return partsCompleted_; }
+
+  /*
+   * The number of bytes that has been parsed.
+   */
+  ::int64_t bytesParsed() const { return bytesParsed_; }
+
+  Http::ParameterMap& parameters() { return parameters_; }
+  Http::UploadedFileMap& files() { return files_; }
+
+private:
+  enum State { Body, DelimiterLine, Headers, Done, Error };
+
+  enum { MAX_HEADER_SIZE = 8 * 1024 };
+
+  std::string delimiter_; // CRLF "--" boundary
+  std::size_t skip_[256];
+
+  State state_;
+  std::string error_;
+
+  // the end of the data, which may be the start of a delimiter
+  std::string carry_;
+
+  // the current line (DelimiterLine, Headers)
+  std::string line_;
+  std::size_t headerSize_;
+
+  // the current part
+  std::string name_, fileName_, contentType_;
+  bool inPart_;
+  std::string value_;
+  std::ofstream file_;
+
+  unsigned partsCompleted_;
+  ::int64_t bytesParsed_;
+
+  Http::ParameterMap parameters_;
+  Http::UploadedFileMap files_;
+
+  const char *find(const char *begin, const char *end) const;
+  std::size_t partialMatch(const char *begin, const char *end) const;
+
+  bool parseLine(const char *& begin, const char *end);
+  void parseHeader();
+  bool beginPart();
+  bool partData(const char *begin, const char *end);
+  bool endPart();
+  bool setError(const std::string& error);
+};
+
+}
+
+#endif // MULTIPART_PARSER_H_
@@ -7,10 +7,12 @@
 #ifndef WT_WEB_CONTROLLER_H_
 #define WT_WEB_CONTROLLER_H_
 
+#include <ctime>
 #include <string>
 #include <vector>
 #include <set>
 #include <map>
+#include <queue>
 
 #include <Wt/WDllDefs.h>
 #include <Wt/WServer>
@@ -18,6 +20,11 @@
 
 #include "SocketNotifier.h"
 
+#ifndef WT_TARGET_JAVA
+#include <boost/detail/atomic_count.hpp>
+#include <boost/weak_ptr.hpp>
+#endif // WT_TARGET_JAVA
+
 #if defined(WT_THREADED) && !defined(WT_TARGET_JAVA)
 #include <boost/thread.hpp>
 #endif
@@ -27,6 +34,7 @@ namespace Wt {
 class Configuration;
 class EntryPoint;
 
+class Time;
 class WebRequest;
 class WebSession;
 
@@ -56,8 +64,8 @@ struct ApplicationEvent {
 
 /*
  * The controller handle incoming request, in handleRequest().
- * Optionally, it will expire session on each incoming request. Seems
- * harmless to me (but causes confusion to others).
+ * Optionally, it will expire sessions using a timer, which is started
+ * by an incoming request.
  *
  * There is a method shutdown() to quit the controller.
  *
@@ -86,6 +94,16 @@ public:
 
   std::string computeRedirectHash(const std::string& url);
 
+  /*
+   * The script library (see WebRenderer::ScriptLibraryFlag), which is
+   * rendered once for each variant.
+   */
+  struct ScriptLibrary {
+    std::string contents, hash;
+  };
+
+  const ScriptLibrary& scriptLibrary(int flags);
+
 #ifndef WT_TARGET_JAVA
   WebController(WServer& server,
 		const std::string& singleSessionId = std::string(),
@@ -94,6 +112,9 @@ public:
 
   int sessionCount() const;
 
+  // the number of requests and events queued for busy sessions
+  int queuedEventCount() const;
+
   // Returns whether we should continue receiving data.
   bool requestDataReceived(WebRequest *request, boost::uintmax_t current,
 			   boost::uintmax_t total);
@@ -102,11 +123,24 @@ public:
 
 #ifndef WT_CNOR
   bool handleApplicationEvent(const ApplicationEvent& event);
+
+  // posts a function to all sessions
+  void postAll(const boost::function<void ()>& function);
+
+  // posts a function to the sessions subscribed to a topic
+  void postAll(const std::string& topic,
+	       const boost::function<void ()>& function);
 #endif // WT_CNOR
 
+  void subscribe(const std::string& topic, const std::string& sessionId);
+  void unsubscribe(const std::string& topic, const std::string& sessionId);
+
   bool expireSessions();
   void shutdown();
 
+  // to be called when a session will expire earlier than before
+  void scheduleExpiry(const std::string& sessionId, const Time& expireTime);
+
   static std::string sessionFromCookie(std::string cookies,
 				       std::string scriptName,
 				       int sessionIdLength);
@@ -130,26 +164,166 @@ private:
   Configuration& conf_;
   std::string singleSessionId_;
   bool autoExpire_;
-  int plainHtmlSessions_, ajaxSessions_;
+  boost::detail::atomic_count sessionCount_;
+  boost::detail::atomic_count plainHtmlSessions_, ajaxSessions_;
+  boost::detail::atomic_count queuedEvents_; // by WebSession::dispatch()
+
+#ifdef WT_COROUTINES
+  /*
+   * Set once a recursive event loop has blocked a thread: from then
+   * on, requests and events run as coroutines (see
+   * WebSession::runQueued()), which a recursive event loop suspends.
+   */
+  boost::detail::atomic_count coroutines_;
+#endif // WT_COROUTINES
   std::string redirectSecret_;
 
 #ifdef WT_THREADED
+  // mutex to protect singleSessionId_, which changes when the session
+  // id of a dedicated process changes
+  boost::mutex singleSessionIdMutex_;
+
   boost::mutex uploadProgressUrlsMutex_;
 #endif // WT_THREADED
   std::set<std::string> uploadProgressUrls_;
 
   typedef std::map<std::string, boost::shared_ptr<WebSession> > SessionMap;
-  SessionMap sessions_;
 
+  /*
+   * The sessions are spread over a number of shards, based on a hash
+   * of their session id. Each shard has its own lock, so that requests
+   * and events for different sessions seldom contend for a lock.
+   *
+   * A shard lock is never held while taking another shard lock, or
+   * while taking a session lock.
+   */
+  struct SessionShard {
 #ifdef WT_THREADED
-  // mutex to protect access to the sessions map and plain/ajax session
-  // counts
-  boost::recursive_mutex mutex_;
+    boost::mutex mutex;
+#endif // WT_THREADED
+    SessionMap sessions;
+  };
+
+  enum { SESSION_SHARDS = 64 };
+  SessionShard shards_[SESSION_SHARDS];
+
+  SessionShard& shard(const std::string& sessionId);
+  boost::shared_ptr<WebSession> findSession(const std::string& sessionId);
+  void sessionRemoved(const boost::shared_ptr<WebSession>& session);
+  std::string singleSessionId();
+
+  /*
+   * Sessions are expired using a min-heap of their (expected) expiry
+   * times, so that expireSessions() only needs to look at sessions
+   * that are due.
+   *
+   * A session's expiry time changes (WebSession::setState()) on
+   * every request, which does not update the heap: when an entry
+   * becomes due, it is rescheduled if the session has been used in
+   * the mean time. A session thus usually has a single entry, which
+   * is looked at about once per timeout, and an entry of a removed
+   * session is discarded when it becomes due. Only when a session
+   * will expire earlier than before, it is scheduled again.
+   *
+   * With autoExpire, expireSessions() is called by a timer every
+   * EXPIRY_INTERVAL while there are sessions, rather than after every
+   * request.
+   */
+  struct Expiry {
+    std::time_t due;
+    std::string sessionId;
+
+    bool operator> (const Expiry& other) const { return due > other.due; }
+  };
+
+  typedef std::priority_queue<Expiry, std::vector<Expiry>,
+			      std::greater<Expiry> > ExpiryQueue;
+
+  enum { EXPIRY_INTERVAL = 1000 }; // ms
+
+#ifdef WT_THREADED
+  // mutex to protect the expiry queue and timer
+  boost::mutex expiryMutex_;
+#endif // WT_THREADED
+  ExpiryQueue expiryQueue_;
+  boost::detail::atomic_count expiryTimerRunning_;
+
+  /*
+   * Incremented by shutdown(), which forgets about a running timer:
+   * a timeout scheduled before then is ignored, and the timer is
+   * started again after the server is restarted.
+   */
+  unsigned expiryTimerGeneration_;
+
+  /*
+   * Shared with a scheduled timeout, which cannot be cancelled and may
+   * fire after the controller is deleted: the destructor clears
+   * controller, and a timeout holds mutex while it runs.
+   */
+  struct ExpiryTimer {
+#ifdef WT_THREADED
+    boost::mutex mutex;
+#endif // WT_THREADED
+    WebController *controller;
+  };
+
+  boost::shared_ptr<ExpiryTimer> expiryTimer_;
+
+  void startExpiryTimer();
+  static void expiryTimeout(boost::shared_ptr<ExpiryTimer> timer,
+			    unsigned generation);
+  void handleExpiryTimeout(unsigned generation);
 
+  /*
+   * Topics to which sessions subscribe, for postAll(). A subscription
+   * does not keep a session alive: the subscriptions of removed
+   * sessions are discarded by the next postAll() to the topic.
+   */
+  typedef std::map<WebSession *, boost::weak_ptr<WebSession> > Subscribers;
+  typedef std::map<std::string, Subscribers> TopicMap;
+
+#ifdef WT_THREADED
+  // mutex to protect the topics
+  boost::mutex topicsMutex_;
+#endif // WT_THREADED
+  TopicMap topics_;
+
+#ifdef WT_THREADED
+  // mutex to protect the script libraries
+  boost::mutex scriptLibrariesMutex_;
+#endif // WT_THREADED
+  std::map<int, ScriptLibrary> scriptLibraries_;
+
+  void serveScriptLibrary(WebRequest *request);
+
+  /*
+   * postAll() delivers to the sessions in batches, which are handled
+   * in parallel by the thread pool, rather than posting an event for
+   * each session which then needs to be looked up.
+   */
+  typedef std::vector<boost::shared_ptr<WebSession> > SessionList;
+
+  enum { BROADCAST_BATCH = 64 };
+
+#ifndef WT_CNOR
+  void broadcast(const SessionList& sessions,
+		 const boost::function<void ()>& function);
+  void handleBroadcast(boost::shared_ptr<SessionList> batch,
+		       boost::function<void ()> function);
+#endif // WT_CNOR
+
+  void handleSessionRequest(boost::shared_ptr<WebSession> session,
+			    WebRequest *request);
+#ifndef WT_CNOR
+  void handleSessionEvent(boost::shared_ptr<WebSession> session,
+			  const ApplicationEvent& event);
+#endif // WT_CNOR
+
+#ifdef WT_THREADED
   SocketNotifier socketNotifier_;
   // mutex to protect access to notifier maps. This cannot be protected
-  // by mutex_ as this lock is grabbed while the application lock is
-  // being held, which would potentially deadlock if we took mutex_.
+  // by a shard lock as this lock is grabbed while the application lock
+  // is being held, which would potentially deadlock.
   boost::recursive_mutex notifierMutex_;
   SocketNotifierMap socketNotifiersRead_;
   SocketNotifierMap socketNotifiersWrite_;
@@ -169,6 +343,8 @@ private:
 #endif // WT_TARGET_JAVA
 
   WServer& server_;
+
+  friend class WebSession;
 };
 
 }
@@ -79,6 +79,21 @@ public:
 
   bool checkResponsePuzzle(const WebRequest& request);
 
+  /*
+   * The script library is the part of the JavaScript (jQuery and the
+   * Wt library in Wt.js) that does not depend on the session. It is
+   * served as a static resource that may be cached by the browser,
+   * in a few variants.
+   */
+  enum ScriptLibraryFlag {
+    LibraryJQuery = 0x1,
+    LibraryInnerHtml = 0x2,
+    LibraryUglyInternalPaths = 0x4,
+    LibraryAllFlags = 0x7
+  };
+
+  static void streamScriptLibrary(std::ostream& out, int flags);
+
 private:
   struct CookieValue {
     std::string value;
@@ -143,6 +158,8 @@ private:
   std::string headDeclarations() const;
   std::string bodyClassRtl() const;
   std::string sessionUrl() const;
+  int scriptLibraryFlags() const;
+  std::string scriptLibraryUrl();
 
   typedef std::set<WWidget *> UpdateMap;
   UpdateMap updateMap_;
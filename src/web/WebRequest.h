@@ -19,6 +19,7 @@
 namespace Wt {
 
 class EntryPoint;
+class MultipartParser;
 class WSslInfo;
 
 /*
@@ -79,6 +80,14 @@ public:
    */
   virtual std::istream& in() = 0;
 
+  /*
+   * Sets a parser for a multipart/form-data body, which the connector
+   * feeds while the body is received, instead of storing it for in().
+   * The request takes ownership of the parser.
+   */
+  void setMultipartParser(MultipartParser *parser);
+  MultipartParser *multipartParser() const { return multipart_; }
+
   /*
    * Access the stream to submit the response.
    *
@@ -89,6 +98,18 @@ public:
 
   WT_BOSTREAM& bout() { return out(); }
 
+  /*
+   * Sends length bytes of a file, starting at offset, as the
+   * remainder of a normal response, without passing it through
+   * out(). This allows a connector to let the kernel transmit the
+   * file (sendfile()).
+   *
+   * Returns false if this is not supported, in which case nothing
+   * happened and the data should be written to out() instead.
+   */
+  virtual bool sendFile(const std::string& fileName,
+			::int64_t offset, ::int64_t length);
+
   /*
    * (Not used)
    */
@@ -203,6 +224,7 @@ private:
   std::string parsePreferredAcceptValue(const std::string& value) const;
 
   ::int64_t postDataExceeded_;
+  MultipartParser *multipart_;
   Http::ParameterMap parameters_;
   Http::UploadedFileMap files_;
   ResponseType responseType_;
@@ -7,6 +7,7 @@
 #ifndef WEBSESSION_H_
 #define WEBSESSION_H_
 
+#include <deque>
 #include <string>
 #include <vector>
 
@@ -19,6 +20,7 @@
 #include <boost/thread/condition.hpp>
 #endif
 
+#include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/enable_shared_from_this.hpp>
 
@@ -31,6 +33,7 @@
 
 namespace Wt {
 
+class Coroutine;
 class WebController;
 class WebRequest;
 class WebResponse;
@@ -106,6 +109,29 @@ public:
   void expire();
   bool unlockRecursiveEventLoop();
 
+#ifndef WT_TARGET_JAVA
+  /*
+   * Runs a request or event for this session.
+   *
+   * These are run one at a time: while one is being run, the others
+   * are queued, instead of blocking threads of the thread pool on the
+   * session lock. Queued functions are posted to the WIOService when
+   * it is their turn.
+   */
+  void dispatch(const boost::function<void ()>& function);
+
+  // the number of queued requests and events
+  int queueDepth();
+
+  /*
+   * Runs a recursive event loop that was suspended when the session
+   * was killed, so that it unwinds now rather than when (or if) the
+   * WIOService gets to it. This must be called without holding the
+   * session lock.
+   */
+  void finishRecursiveEventLoop();
+#endif // WT_TARGET_JAVA
+
   void pushEmitStack(WObject *obj);
   void popEmitStack();
   WObject *emitStackTop();
@@ -256,11 +282,33 @@ public:
 private:
   void handleWebSocketRequest(Handler& handler);
   static void handleWebSocketMessage(boost::weak_ptr<WebSession> session);
+  static void processWebSocketMessage(boost::weak_ptr<WebSession> session);
   static void webSocketReady(boost::weak_ptr<WebSession> session);
 
   void checkTimers();
   void hibernate();
 
+#ifdef WT_THREADED
+  // the queue of requests and events, see dispatch()
+  boost::mutex queueMutex_;
+  std::deque<boost::function<void ()> > queue_;
+  bool queueBusy_;
+  boost::thread::id queueOwner_;
+  bool deferredUpdates_; // left by a handler for the queue to push
+
+  void runQueued(const boost::function<void ()>& function);
+  void yieldQueue();
+  void releaseQueue();
+  void pushDeferredUpdates();
+#endif // WT_THREADED
+
+  bool deferUpdates();
+
+#ifdef WT_COROUTINES
+  void runCoroutine(Coroutine *coroutine);
+  void resumeCoroutine();
+#endif // WT_COROUTINES
+
 #ifdef WT_BOOST_THREADS
   boost::mutex mutex_;
   static boost::thread_specific_ptr<Handler> threadHandler_;
@@ -316,6 +364,14 @@ private:
   std::vector<WObject *> emitStack_;
 
   Handler *recursiveEventLoop_;
+#ifdef WT_COROUTINES
+  // the suspended recursive event loop, see doRecursiveEventLoop()
+  Coroutine *recursiveCoroutine_;
+
+  // the suspended loop once unlocked, until it is resumed
+  // (protected by queueMutex_)
+  Coroutine *resumableCoroutine_;
+#endif // WT_COROUTINES
 
   WResource *decodeResource(const std::string& resourceId);
   EventSignalBase *decodeSignal(const std::string& signalId,
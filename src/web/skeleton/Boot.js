@@ -201,18 +201,21 @@ _$_$endif_$_();
     }
 
     var allInfo = hashInfo + scaleInfo + htmlHistoryInfo + deployPathInfo;
+    /* The library is the same for all sessions, and may be cached */
+    loadScript(_$_SCRIPT_LIBRARY_URL_$_, function() {
 _$_$ifnot_SPLIT_SCRIPT_$_();
-    loadScript(selfUrl + allInfo + '&request=script&rand=' + rand(),
-               null);
+      loadScript(selfUrl + allInfo + '&request=script&rand=' + rand(),
+                 null);
 _$_$endif_$_();
 _$_$if_SPLIT_SCRIPT_$_();
-    /* Ideally, we should be able to omit the sessionid too */
-    loadScript(selfUrl + allInfo + '&request=script&skeleton=true',
-               function() {
-                 loadScript(selfUrl + allInfo
-                            + '&request=script&rand=' + rand(), null);
-               });
+      /* Ideally, we should be able to omit the sessionid too */
+      loadScript(selfUrl + allInfo + '&request=script&skeleton=true',
+                 function() {
+                   loadScript(selfUrl + allInfo
+                              + '&request=script&rand=' + rand(), null);
+                 });
 _$_$endif_$_();
+    });
   }
 }
     }
@@ -3,5 +3,5 @@ window.onresize=function(){};function loadScript(q,o){var c=document.createEleme
 function y(b,m){var h,e,i,v,w=false;e=u();h=0;for(v=e.length;h<v;h++){i=e[h].split("=");if(i.length>=2)if(i[0]===b){i[1]=escape(m);e[h]=i.join("=");w=true;break}}w||e.push(b+"="+escape(m));return"?"+e.join("&")+window.location.hash}var l=document,f=window;try{l.execCommand("BackgroundImageCache",false,true)}catch(A){}f.opera&&f.opera.setOverrideHistoryNavigationMode("compatible");var g=_$_PATH_INFO_$_,d=f.location.pathname;f.opera||(d=decodeURIComponent(d));if(g.length>0){var a=d.lastIndexOf(g);if(a!=
 -1)d=d.substr(0,a)+d.substr(a+g.length)}g="&deployPath="+encodeURIComponent(d);var j=f.XMLHttpRequest||f.ActiveXObject;l.cookie="jscookietest=valid";var n=_$_RELOAD_IS_NEWSESSION_$_||_$_USE_COOKIES_$_&&l.cookie.indexOf("jscookietest=valid")!=-1;l.cookie="jscookietest=valid;expires=Thu, 01 Jan 1970 00:00:00 GMT";d=new Date;d.setTime(d.getTime()+1E3);l.cookie="WtTestCookie=ok;path=/;expires="+d.toGMTString();a=f.location.hash;if(a.length>0)a=a.substr(1);var k=a.indexOf("?");if(k!=-1)a=a.substr(0,k);
 k=navigator.userAgent.toLowerCase();if(k.indexOf("gecko")==-1||k.indexOf("webkit")!=-1)a=unescape(a);k="";if(screen.deviceXDPI!=screen.logicalXDPI)k="&scale="+screen.deviceXDPI/screen.logicalXDPI;var p=_$_SELF_URL_$_+"&sid="+_$_SCRIPT_ID_$_,r=!!(window.history&&window.history.pushState),z=r?"&htmlHistory=true":"";if(n=!n||!j)if(x("wtd")==="_$_SESSION_ID_$_")n=false;if(n)if(r)c(y("wtd","_$_SESSION_ID_$_"));else{g=a.length>1&&a.charAt(0)=="/"?a:_$_INTERNAL_PATH_$_;if(g.length>0)p+="#"+g;c(p)}else if(j){j=
-_$_AJAX_CANONICAL_URL_$_;n="";if(!r&&j.length>1){_$_$if_HYBRID_$_();g="WtInternalPath="+escape(_$_INTERNAL_PATH_$_)+";path=/;expires="+d.toGMTString();l.cookie=g;_$_$endif_$_();if(j.charAt(0)=="#")j="../"+j;c(j)}else{if(a.length>1&&a.charAt(0)=="/"){n="&_="+encodeURIComponent(a);_$_$if_HYBRID_$_();a!=_$_INTERNAL_PATH_$_&&setTimeout(t,10);_$_$endif_$_()}var s=n+k+z+g;_$_$ifnot_SPLIT_SCRIPT_$_();loadScript(p+s+"&request=script&rand="+o(),null);_$_$endif_$_();_$_$if_SPLIT_SCRIPT_$_();loadScript(p+s+
-"&request=script&skeleton=true",function(){loadScript(p+s+"&request=script&rand="+o(),null)});_$_$endif_$_()}}}_$_$if_DEFER_SCRIPT_$_();setTimeout(q,0);_$_$endif_$_();_$_$ifnot_DEFER_SCRIPT_$_();q();_$_$endif_$_()})();
+_$_AJAX_CANONICAL_URL_$_;n="";if(!r&&j.length>1){_$_$if_HYBRID_$_();g="WtInternalPath="+escape(_$_INTERNAL_PATH_$_)+";path=/;expires="+d.toGMTString();l.cookie=g;_$_$endif_$_();if(j.charAt(0)=="#")j="../"+j;c(j)}else{if(a.length>1&&a.charAt(0)=="/"){n="&_="+encodeURIComponent(a);_$_$if_HYBRID_$_();a!=_$_INTERNAL_PATH_$_&&setTimeout(t,10);_$_$endif_$_()}var s=n+k+z+g;loadScript(_$_SCRIPT_LIBRARY_URL_$_,function(){_$_$ifnot_SPLIT_SCRIPT_$_();loadScript(p+s+"&request=script&rand="+o(),null);_$_$endif_$_();_$_$if_SPLIT_SCRIPT_$_();
+loadScript(p+s+"&request=script&skeleton=true",function(){loadScript(p+s+"&request=script&rand="+o(),null)});_$_$endif_$_()})}}}_$_$if_DEFER_SCRIPT_$_();setTimeout(q,0);_$_$endif_$_();_$_$ifnot_DEFER_SCRIPT_$_();q();_$_$endif_$_()})();
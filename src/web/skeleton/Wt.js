@@ -4,6 +4,7 @@
  *
  * For terms of use, see LICENSE.
  */
+_$_$if_LIBRARY_$_();
 _$_$if_DYNAMIC_JS_$_();
 window.JavaScriptFunction = 1;
 window.JavaScriptConstructor = 2;
@@ -1014,6 +1015,25 @@ this.inline = function(o) { WT.getElement(o).style.display = 'inline'; };
 this.block = function(o) { WT.getElement(o).style.display = 'block'; };
 this.show = function(o) { WT.getElement(o).style.display = ''; };
 
+/*
+ * Applies a compact update of an element (see DomElement): a list of
+ * operations of three items each: an opcode, a name and a value.
+ */
+this.upd = function(o, ops) {
+  var el = typeof o === 'string' ? WT.getElement(o) : o, i, il;
+
+  for (i = 0, il = ops.length; i < il; i += 3) {
+    var n = ops[i + 1], v = ops[i + 2];
+
+    switch (ops[i]) {
+    case 0: el.style[n] = v; break;
+    case 1: el[n] = v; break;
+    case 2: el.setAttribute(n, v); break;
+    case 3: WT.setHtml(el, v, n); break;
+    }
+  }
+};
+
 var captureElement = null;
 this.firedTarget = null;
 
@@ -1786,6 +1806,9 @@ _$_$endif_$_();
 
 })();
 
+_$_$endif_$_();
+
+_$_$if_APPLICATION_$_();
 if (window._$_APP_CLASS_$_) {
   try {
     window._$_APP_CLASS_$_._p_.quit();
@@ -3001,3 +3024,4 @@ window._$_APP_CLASS_$_SignalEmit = _$_APP_CLASS_$_.emit;
 window._$_APP_CLASS_$_OnLoad = function() {
   _$_APP_CLASS_$_._p_.load();
 };
+_$_$endif_$_();
@@ -13,7 +13,7 @@
  http://developer.yahoo.net/yui/license.txt
  version: 2.5.2
 */
-_$_$if_DYNAMIC_JS_$_();window.JavaScriptFunction=1;window.JavaScriptConstructor=2;window.JavaScriptObject=3;window.JavaScriptPrototype=4;window.WT_DECLARE_WT_MEMBER=function(L,M,E,J){if(M==JavaScriptPrototype){L=E.indexOf(".prototype");_$_WT_CLASS_$_[E.substr(0,L)].prototype[E.substr(L+11)]=J}else _$_WT_CLASS_$_[E]=M==JavaScriptFunction?function(){return J.apply(_$_WT_CLASS_$_,arguments)}:J};
+_$_$if_LIBRARY_$_();_$_$if_DYNAMIC_JS_$_();window.JavaScriptFunction=1;window.JavaScriptConstructor=2;window.JavaScriptObject=3;window.JavaScriptPrototype=4;window.WT_DECLARE_WT_MEMBER=function(L,M,E,J){if(M==JavaScriptPrototype){L=E.indexOf(".prototype");_$_WT_CLASS_$_[E.substr(0,L)].prototype[E.substr(L+11)]=J}else _$_WT_CLASS_$_[E]=M==JavaScriptFunction?function(){return J.apply(_$_WT_CLASS_$_,arguments)}:J};
 window.WT_DECLARE_APP_MEMBER=function(L,M,E,J){var O=window.currentApp;if(M==JavaScriptPrototype){L=E.indexOf(".prototype");O[E.substr(0,L)].prototype[E.substr(L+11)]=J}else O[E]=M==JavaScriptFunction?function(){return J.apply(O,arguments)}:J};_$_$endif_$_();
 if(!window._$_WT_CLASS_$_)window._$_WT_CLASS_$_=new (function(){function L(a){return a.split("/")[2]}function M(a,b,e){if(a=="auto"||a==null)return e;return(a=(a=b.exec(a))&&a.length==2?a[1]:null)?parseFloat(a):e}function E(a,b){return M(a,/^\s*(-?\d+(?:\.\d+)?)\s*\%\s*$/i,b)}function J(a){if(K==null)return null;if(!a)a=window.event;if(a){for(var b=a=g.target(a);b&&b!=K;)b=b.parentNode;return b==K?g.isIElt9?a:null:K}else return K}function O(a){var b=J(a);if(b&&!W){if(!a)a=window.event;W=true;if(g.isIElt9){g.firedTarget=
 a.srcElement||b;b.fireEvent("onmousemove",a);g.firedTarget=null}else g.condCall(b,"onmousemove",a);return W=false}else return true}function X(a){var b=J(a);g.capture(null);if(b){if(!a)a=window.event;if(g.isIElt9){g.firedTarget=a.srcElement||b;b.fireEvent("onmouseup",a);g.firedTarget=null}else g.condCall(b,"onmouseup",a);g.cancelEvent(a,g.CancelPropagate);return false}else return true}function ma(){if(!fa){fa=true;if(document.body.addEventListener){var a=document.body;a.addEventListener("mousemove",
@@ -44,7 +44,7 @@ a.keyCode==27||a.keyCode==32||a.keyCode>46&&a.keyCode<112};var T=null,Z=null;thi
 this.parsePx=function(a){return M(a,/^\s*(-?\d+(?:\.\d+)?)\s*px\s*$/i,0)};this.px=function(a,b){return g.parsePx(g.css(a,b))};this.pxself=function(a,b){return g.parsePx(a.style[b])};this.pctself=function(a,b){return E(a.style[b],0)};this.cssPrefix=function(a){var b=["Moz","Webkit"],e=document.createElement("div"),i,k;i=0;for(k=b.length;i<k;++i)if(b[i]+a in e.style)return b[i];return null};this.boxSizing=function(a){return(a.style.boxSizing||a.style.MozBoxSizing||a.style.WebkitBoxSizing)==="border-box"};
 this.isHidden=function(a){if(a.style.display=="none")return true;else return(a=a.parentNode)&&!g.hasTag(a,"BODY")?g.isHidden(a):false};this.innerWidth=function(a){var b=a.offsetWidth;g.boxSizing(a)||(b-=g.px(a,"paddingLeft")+g.px(a,"paddingRight")+g.px(a,"borderLeftWidth")+g.px(a,"borderRightWidth"));return b};this.innerHeight=function(a){var b=a.offsetHeight;g.boxSizing(a)||(b-=g.px(a,"paddingTop")+g.px(a,"paddingBottom")+g.px(a,"borderTopWidth")+g.px(a,"borderBottomWidth"));return b};this.IEwidth=
 function(a,b,e){if(a.parentNode){var i=a.parentNode.clientWidth-g.px(a,"marginLeft")-g.px(a,"marginRight")-g.px(a,"borderLeftWidth")-g.px(a,"borderRightWidth")-g.px(a.parentNode,"paddingLeft")-g.px(a.parentNode,"paddingRight");b=E(b,0);e=E(e,1E5);return i<b?b-1:i>e?e+1:a.style.styleFloat!=""?b-1:"auto"}else return"auto"};this.hide=function(a){g.getElement(a).style.display="none"};this.inline=function(a){g.getElement(a).style.display="inline"};this.block=function(a){g.getElement(a).style.display="block"};
-this.show=function(a){g.getElement(a).style.display=""};var K=null;this.firedTarget=null;this.target=function(a){try{return g.firedTarget||a.target||a.srcElement}catch(b){return null}};var fa=false;this.capture=function(a){ma();if(!(K&&a)){K=a;var b=document.body;document.body.addEventListener||(a!=null?b.setCapture():b.releaseCapture());if(a!=null){$(b).addClass("unselectable");b.setAttribute("unselectable","on");b.onselectstart="return false;"}else{$(b).removeClass("unselectable");b.setAttribute("unselectable",
+this.show=function(a){g.getElement(a).style.display=""};this.upd=function(a,b){var e=typeof a==="string"?g.getElement(a):a,i,d;i=0;for(d=b.length;i<d;i+=3){var f=b[i+1],h=b[i+2];switch(b[i]){case 0:e.style[f]=h;break;case 1:e[f]=h;break;case 2:e.setAttribute(f,h);break;case 3:g.setHtml(e,h,f)}}};var K=null;this.firedTarget=null;this.target=function(a){try{return g.firedTarget||a.target||a.srcElement}catch(b){return null}};var fa=false;this.capture=function(a){ma();if(!(K&&a)){K=a;var b=document.body;document.body.addEventListener||(a!=null?b.setCapture():b.releaseCapture());if(a!=null){$(b).addClass("unselectable");b.setAttribute("unselectable","on");b.onselectstart="return false;"}else{$(b).removeClass("unselectable");b.setAttribute("unselectable",
 "off");b.onselectstart=""}}};this.checkReleaseCapture=function(a,b){b&&K&&a==K&&b.type=="mouseup"&&this.capture(null)};this.getElementsByClassName=function(a,b){if(document.getElementsByClassName)return b.getElementsByClassName(a);else{b=b.getElementsByTagName("*");for(var e=[],i,k=0,l=b.length;k<l;k++){i=b[k];i.className.indexOf(a)!=-1&&e.push(i)}return e}};var R=null;this.addCss=function(a,b){var e=ga();e.insertRule(a+" { "+b+" }",e.cssRules?e.cssRules.length:0)};this.addCssText=function(a){var b=
 document.getElementById("Wt-inline-css");if(!b){b=document.createElement("style");b.id="Wt-inline-css";document.getElementsByTagName("head")[0].appendChild(b)}if(b.styleSheet){var e=b.previousSibling;if(!e||!g.hasTag(e,"STYLE")||e.styleSheet.cssText.length>32768){e=document.createElement("style");b.parentNode.insertBefore(e,b);e.styleSheet.cssText=a}else e.styleSheet.cssText+=a}else{a=document.createTextNode(a);b.appendChild(a)}};this.getCssRule=function(a,b){a=a.toLowerCase();if(document.styleSheets)for(var e=
 0;e<document.styleSheets.length;e++){var i=document.styleSheets[e],k=0,l;do{l=null;try{if(i.cssRules)l=i.cssRules[k];else if(i.rules)l=i.rules[k];if(l&&l.selectorText)if(l.selectorText.toLowerCase()==a)if(b=="delete"){i.cssRules?i.deleteRule(k):i.removeRule(k);return true}else return l}catch(p){}++k}while(l)}return false};this.removeCssRule=function(a){return g.getCssRule(a,"delete")};this.addStyleSheet=function(a,b){if(document.createStyleSheet)setTimeout(function(){document.createStyleSheet(a)},
@@ -58,7 +58,7 @@ window.history&&window.history.pushState?function(){function a(p){k[l.location.p
 m='<html><body><div id="state">'+m+"</div></body></html>";try{q=y.contentWindow.document;q.open();q.write(m);q.close();return true}catch(B){return false}}function l(){var m,q,B,F;if(!y.contentWindow||!y.contentWindow.document)setTimeout(l,10);else{m=y.contentWindow.document;B=(q=m.getElementById("state"))?q.innerText:null;F=a();setInterval(function(){var U,C;m=y.contentWindow.document;U=(q=m.getElementById("state"))?q.innerText:null;C=a();if(U!==B){B=U;i(B);C=B?B:n;F=location.hash=C;b()}else if(C!==
 F){F=C;k(C)}},50);D=true;x!=null&&x()}}function p(){if(!r){var m=a(),q=history.length;G&&clearInterval(G);G=setInterval(function(){var B,F;B=a();F=history.length;if(B!==m){m=B;q=F;i(m);b()}else if(F!==q&&t){m=B;q=F;B=I[q-1];i(B);b()}},50)}}function s(){var m;m=u.value.split("|");if(m.length>1){n=m[0];H=m[1]}else n=H="";if(m.length>2)I=m[2].split(",");if(r)l();else{p();D=true;x!=null&&x()}}var t=false,r=g.isIElt9,w=false,x=null,y=null,u=null,D=false,G=null,I=[],n,H,ba=[];return{_initialize:function(){u!=
 null&&s()},_initTimeout:function(){p()},register:function(m,q){if(!D)H=n=escape(m);ba.push(q)},initialize:function(m,q){if(!D){var B=navigator.vendor||"";if(B!=="KDE")if(typeof window.opera!=="undefined")w=true;else if(!r&&B.indexOf("Apple Computer, Inc.")>-1)t=true;if(typeof m==="string")m=document.getElementById(m);if(!(!m||m.tagName.toUpperCase()!=="TEXTAREA"&&(m.tagName.toUpperCase()!=="INPUT"||m.type!=="hidden"&&m.type!=="text"))){u=m;if(r){if(typeof q==="string")q=document.getElementById(q);
-!q||q.tagName.toUpperCase()!=="IFRAME"||(y=q)}}}},navigate:function(m,q){m=ha(m);if(D){m=m;if(r)k(m);else{if(m.length>0)location.hash=m;if(t){I[history.length]=m;b()}}q&&e()}},getCurrentState:function(){if(!D)return"";return unescape(H)}}}()});if(window._$_APP_CLASS_$_)try{window._$_APP_CLASS_$_._p_.quit()}catch(e$$28){}
+!q||q.tagName.toUpperCase()!=="IFRAME"||(y=q)}}}},navigate:function(m,q){m=ha(m);if(D){m=m;if(r)k(m);else{if(m.length>0)location.hash=m;if(t){I[history.length]=m;b()}}q&&e()}},getCurrentState:function(){if(!D)return"";return unescape(H)}}}()});_$_$endif_$_();_$_$if_APPLICATION_$_();if(window._$_APP_CLASS_$_)try{window._$_APP_CLASS_$_._p_.quit()}catch(e$$28){}
 window._$_APP_CLASS_$_=new (function(){function L(c){c=n.pageCoordinates(c);H=c.x;ba=c.y}function M(){var c=_$_WT_CLASS_$_.history.getCurrentState();if(!(c!=null&&c.length>0&&c.substr(0,1)!="/"))if(q!=c){q=c;setTimeout(function(){a(null,"hash",null,true)},1)}}function E(c){if(!(q==c||!q&&c=="/")){q=c;n.history.navigate(c,false)}}function J(){document.body.ondragstart=function(){return false}}function O(c,d){var f=n.target(d);if(f)if(f.offsetWidth>f.clientWidth||f.offsetHeight>f.clientHeight){var h=
 n.widgetPageCoordinates(f),o=n.pageCoordinates(d),j=o.y-h.y;if(o.x-h.x>f.clientWidth||j>f.clientHeight)return true}f=B;f.object=n.getElement(c.getAttribute("dwid"));if(f.object==null)return true;f.sourceId=c.getAttribute("dsid");f.objectPrevStyle={position:f.object.style.position,display:f.object.style.display,left:f.object.style.left,top:f.object.style.top,className:f.object.className};f.object.parentNode.removeChild(f.object);f.object.style.position="absolute";f.object.className="";f.object.style["z-index"]=
 "1000";document.body.appendChild(f.object);n.capture(null);n.capture(f.object);f.object.onmousemove=X;f.object.onmouseup=ma;f.offsetX=-4;f.offsetY=-4;f.dropTarget=null;f.mimeType=c.getAttribute("dmt");f.xy=n.pageCoordinates(d);n.cancelEvent(d,n.CancelPropagate);return false}function X(c){if(B.object!=null){var d=B,f=n.pageCoordinates(c);if(d.object.style.display!=""&&d.xy.x!=f.x&&d.xy.y!=f.y)d.object.style.display="";d.object.style.left=f.x-d.offsetX+"px";d.object.style.top=f.y-d.offsetY+"px";f=d.dropTarget;
@@ -86,4 +86,4 @@ d)}function u(c){q=c;n.history.register(c,M)}function D(c){if(c.ieAlternativeExe
 da,Q=false,ya=false,ua=false,N=null,V=null,ka=null,la=0,va=false,ca=null,na=null,A={state:0,socket:null,keepAlive:null,reconnectTries:0},pa=false;fa(_$_SESSION_URL_$_);var oa=n.initAjaxComm(da,K),qa=false,wa,sa=_$_ACK_UPDATE_ID_$_,ra=null,xa=0,ea={};x.prototype.preload=function(c){var d=new Image;this.images.push(d);d.onload=x.prototype.onload;d.onerror=x.prototype.onload;d.onabort=x.prototype.onload;d.imagePreloader=this;d.src=c};x.prototype.onload=function(){var c=this.imagePreloader;--c.work==
 0&&c.callback(c.images)};y.prototype.preload=function(c,d){var f=new XMLHttpRequest;f.open("GET",c,true);f.responseType="arraybuffer";f.arrayBuffers=this.arrayBuffers;f.preloader=this;f.index=d;f.uri=c;f.onload=function(){console.log("XHR load buffer "+this.index+" from uri "+this.uri);this.arrayBuffers[this.index]=this.response;this.preloader.afterLoad()};f.onerror=y.prototype.afterload;f.onabort=y.prototype.afterload;f.send()};y.prototype.afterLoad=function(){--this.work==0&&this.callback(this.arrayBuffers)};
 window.onunload=function(){if(!Q){I.emit(I,"Wt-unload");b();k()}};this._p_={ieAlternative:D,loadScript:w,onJsLoad:t,setTitle:P,update:a,quit:S,setSessionUrl:fa,setFormObjects:function(c){F=c},saveDownPos:L,addTimerEvent:s,load:Y,setServerPush:Z,dragStart:O,dragDrag:X,dragEnd:ma,capture:n.capture,enableInternalPaths:u,onHashChange:M,setHash:E,ImagePreloader:x,ArrayBufferPreloader:y,doAutoJavaScript:ja,autoJavaScript:function(){},response:e,setPage:i,setCloseMessage:G,propagateSize:l};this.WT=_$_WT_CLASS_$_;
-this.emit=p});window._$_APP_CLASS_$_SignalEmit=_$_APP_CLASS_$_.emit;window._$_APP_CLASS_$_OnLoad=function(){_$_APP_CLASS_$_._p_.load()};
+this.emit=p});window._$_APP_CLASS_$_SignalEmit=_$_APP_CLASS_$_.emit;window._$_APP_CLASS_$_OnLoad=function(){_$_APP_CLASS_$_._p_.load()};_$_$endif_$_();